@@ -0,0 +1,95 @@
+/*
+ * astar.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef ASTAR_HPP
+#define ASTAR_HPP
+
+#include <cstdint>
+#include <utility>  // std::pair
+
+#include "gdalwrap/gdal.hpp"
+#include "gdalwrap/radix_heap.hpp"
+
+namespace gdalwrap {
+
+/** A* / Theta* path planner on a cost band, with a reusable workspace
+ *
+ * The cost band is a cost per meter, cells <= 0 or NaN are obstacles.
+ * Moving between 8-neighbours costs the distance times the mean cost of
+ * the two cells. With `any_angle` (Theta*), a node can link to the
+ * parent of its predecessor when the straight segment is free, its cost
+ * being integrated exactly cell by cell along the segment.
+ *
+ * The workspace (g values, parents, closed bitset, open set) is kept
+ * between queries: the per cell arrays are only reallocated when the map
+ * size changes, and g values are invalidated with a query stamp instead
+ * of being cleared. A* keys are monotone and use a radix heap; Theta*
+ * keys are not (a node can get a cheaper parent), so it uses a binary
+ * heap. The minimum of the cost band is computed once and cached.
+ */
+class astar {
+    std::vector<float>    g;       // cost from the start
+    std::vector<uint32_t> parent;  // cell index
+    std::vector<uint32_t> stamp;   // query of the g / parent values
+    std::vector<uint64_t> closed;  // bitset
+    radix_heap<uint32_t>  open;    // A*
+    std::vector<std::pair<float, uint32_t>> open_any; // Theta*, min heap
+    uint32_t query;
+    float cost;
+    const float* min_band; // band of the cached minimum
+    size_t min_size;
+    float min_value;
+
+    void reserve(size_t size);
+    bool is_closed(size_t i) const {
+        return (closed[i >> 6] >> (i & 63)) & 1;
+    }
+    void set_closed(size_t i) {
+        closed[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+
+public:
+    astar() : query(0), cost(0), min_band(NULL), min_size(0),
+        min_value(0) {}
+
+    /** Plan a path from start to goal
+     *
+     * @param map gdal instance.
+     * @param band number [0,n-1] of the cost band.
+     * @param start in UTM (or custom frame).
+     * @param goal in UTM (or custom frame).
+     * @param custom true if points (and the result) are in the custom frame.
+     * @param any_angle Theta* instead of A* (8-connected).
+     * @param min_cost lower bound of the cost band for the heuristic,
+     *        if <= 0 the minimum of the band, cached between queries on
+     *        the same band (see reset_min_cost).
+     * @returns cell centers from start to goal, empty if no path.
+     */
+    points_xy_t plan(const gdal& map, size_t band,
+            const point_xy_t& start, const point_xy_t& goal,
+            bool custom = false, bool any_angle = false,
+            float min_cost = 0);
+
+    /** Forget the cached minimum, to call after lowering costs in place
+     * (raising costs or adding obstacles keeps it a valid lower bound)
+     */
+    void reset_min_cost() {
+        min_band = NULL;
+    }
+
+    /** Cost of the last path found (infinity if none)
+     */
+    float get_cost() const {
+        return cost;
+    }
+};
+
+} // namespace gdalwrap
+
+#endif // ASTAR_HPP
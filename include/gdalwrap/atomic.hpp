@@ -0,0 +1,166 @@
+/*
+ * atomic.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+#include <cmath>    // NAN
+#include <cstdint>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Lock-free cell operations (GCC/Clang __atomic builtins)
+ *
+ * They work in place on plain band storage (float, double, integers),
+ * floats are compared and swapped bitwise. Several threads can update the
+ * same band as long as none of them resizes it.
+ */
+
+template <class T>
+inline T atomic_load(const T *cell) {
+    T value;
+    __atomic_load(cell, &value, __ATOMIC_RELAXED);
+    return value;
+}
+
+template <class T>
+inline void atomic_store(T *cell, T value) {
+    __atomic_store(cell, &value, __ATOMIC_RELAXED);
+}
+
+/** Compare and swap, true if the cell was expected and is now desired
+ */
+template <class T>
+inline bool atomic_cas(T *cell, T expected, T desired) {
+    return __atomic_compare_exchange(cell, &expected, &desired, false,
+        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+/** Atomically replace the cell by f(cell), returns the previous value
+ *
+ * f can be called several times (CAS loop), it must have no side effect.
+ */
+template <class T, class F>
+inline T atomic_update(T *cell, F f) {
+    T old = atomic_load(cell), value;
+    do {
+        value = f(old);
+    } while ( !__atomic_compare_exchange(cell, &old, &value, true,
+        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ); // old is reloaded on failure
+    return old;
+}
+
+/** Atomic add, returns the previous value
+ */
+template <class T>
+inline T atomic_add(T *cell, T value) {
+    return atomic_update(cell, [value](T old) -> T { return old + value; });
+}
+inline int32_t atomic_add(int32_t *cell, int32_t value) {
+    return __atomic_fetch_add(cell, value, __ATOMIC_ACQ_REL);
+}
+inline uint32_t atomic_add(uint32_t *cell, uint32_t value) {
+    return __atomic_fetch_add(cell, value, __ATOMIC_ACQ_REL);
+}
+
+/** Atomic min, returns the previous value (no write if not smaller)
+ */
+template <class T>
+inline T atomic_min(T *cell, T value) {
+    T old = atomic_load(cell);
+    while ( value < old and !__atomic_compare_exchange(cell, &old, &value,
+        true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) );
+    return old;
+}
+
+/** Atomic max, returns the previous value (no write if not greater)
+ */
+template <class T>
+inline T atomic_max(T *cell, T value) {
+    T old = atomic_load(cell);
+    while ( old < value and !__atomic_compare_exchange(cell, &old, &value,
+        true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) );
+    return old;
+}
+
+/** Concurrent writer on a gdal instance
+ *
+ * Each sensor thread can own a writer on the same map and fuse its data
+ * without a global mutex: every operation is a lock-free update of one
+ * cell. The size and number of bands must not change meanwhile.
+ * Operations with an out of bounds index (see gdal::index_*) do nothing,
+ * and load returns NaN.
+ */
+class concurrent_writer {
+    gdal& map;
+
+    float *cell(size_t band, size_t index) const {
+        return map.bands[band].data() + index;
+    }
+    bool inside(size_t index) const {
+        return index < map.get_width() * map.get_height();
+    }
+
+public:
+    concurrent_writer(gdal& map) : map(map) {}
+
+    float load(size_t band, size_t index) const {
+        return inside(index) ? atomic_load(cell(band, index)) : NAN;
+    }
+    void store(size_t band, size_t index, float value) {
+        if (inside(index))
+            atomic_store(cell(band, index), value);
+    }
+    bool cas(size_t band, size_t index, float expected, float desired) {
+        return inside(index) and
+            atomic_cas(cell(band, index), expected, desired);
+    }
+    void add(size_t band, size_t index, float value) {
+        if (inside(index))
+            atomic_add(cell(band, index), value);
+    }
+    void min(size_t band, size_t index, float value) {
+        if (inside(index))
+            atomic_min(cell(band, index), value);
+    }
+    void max(size_t band, size_t index, float value) {
+        if (inside(index))
+            atomic_max(cell(band, index), value);
+    }
+    template <class F>
+    void update(size_t band, size_t index, F f) {
+        if (inside(index))
+            atomic_update(cell(band, index), f);
+    }
+
+    void add_utm(size_t band, double x, double y, float value) {
+        add(band, map.index_utm(x, y), value);
+    }
+    void min_utm(size_t band, double x, double y, float value) {
+        min(band, map.index_utm(x, y), value);
+    }
+    void max_utm(size_t band, double x, double y, float value) {
+        max(band, map.index_utm(x, y), value);
+    }
+    void add_custom(size_t band, double x, double y, float value) {
+        add(band, map.index_custom(x, y), value);
+    }
+    void min_custom(size_t band, double x, double y, float value) {
+        min(band, map.index_custom(x, y), value);
+    }
+    void max_custom(size_t band, double x, double y, float value) {
+        max(band, map.index_custom(x, y), value);
+    }
+};
+
+} // namespace gdalwrap
+
+#endif // ATOMIC_HPP
@@ -0,0 +1,54 @@
+/*
+ * change.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef CHANGE_HPP
+#define CHANGE_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+#include "gdalwrap/labeling.hpp"
+
+namespace gdalwrap {
+
+// band names of the change_detection result
+extern const std::string change_difference; // after - before
+extern const std::string change_mask;       // 1 if |difference| >= threshold
+
+/** Change detection between two surveys overlapping in UTM
+ *
+ * The result is on the grid of `after`, cropped to the overlap of both
+ * extents; `before` is sampled at each cell center (point_pix2utm then
+ * point_utm2pix), so resolutions and origins may differ.
+ * Difference, threshold and mask are computed in one parallel pass,
+ * then the changed cells are labeled (see connected_components).
+ * Cells equal to no_data (or NaN) in either band are not compared:
+ * their difference is NaN and they are unchanged.
+ *
+ * @param before gdal instance of the older survey.
+ * @param band_before band number in before.
+ * @param after gdal instance of the newer survey.
+ * @param band_after band number in after.
+ * @param threshold minimum absolute difference of a change.
+ * @param labels output label band of the changed regions.
+ * @param components output statistics of the changed regions.
+ * @param no_data value of the cells to ignore.
+ * @param interpolate bilinear sampling of before (nearest otherwise).
+ * @returns gdal with the bands change_difference and change_mask,
+ *          empty (0 x 0) if the surveys do not overlap.
+ */
+gdal change_detection(const gdal& before, size_t band_before,
+        const gdal& after, size_t band_after, float threshold,
+        labels_t& labels, components_t& components,
+        float no_data = std::numeric_limits<float>::quiet_NaN(),
+        bool interpolate = false);
+
+} // namespace gdalwrap
+
+#endif // CHANGE_HPP
@@ -0,0 +1,71 @@
+/*
+ * contour.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef CONTOUR_HPP
+#define CONTOUR_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Contour line (iso-line) at a level
+ */
+struct contour_t {
+    float level;
+    bool closed;        // last point == first point
+    points_xy_t points;
+};
+typedef std::vector<contour_t> contours_t;
+
+/** Contour lines of a band by marching squares
+ *
+ * Squares of 4 cell centers are processed by rows in parallel, saddles are
+ * resolved with the mean of the 4 corners, then segments sharing a grid
+ * edge are stitched into polylines (open at the border and at no-data).
+ *
+ * @param band raster of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param levels values of the contours.
+ * @param no_data squares with a no_data (or NaN) corner are skipped.
+ * @returns contours in pixels (cell centers are integers), by level.
+ */
+contours_t contours(const raster& band, size_t width, size_t height,
+        const std::vector<float>& levels,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** Contour lines of a gdal band in UTM or custom coordinates
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param levels values of the contours.
+ * @param custom coordinates in the custom frame (UTM otherwise).
+ * @param no_data squares with a no_data (or NaN) corner are skipped.
+ */
+contours_t contours(const gdal& map, size_t band,
+        const std::vector<float>& levels, bool custom = false,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** Save contours as line strings with a LEVEL field (OGR)
+ *
+ * @param lines contours in UTM (the projection of map is used).
+ * @param map gdal instance, for its UTM zone.
+ * @param filepath path to the vector file to write.
+ * @param driver OGR driver short name (default "ESRI Shapefile").
+ * @throws std::runtime_error if the file can not be created.
+ */
+void save_contours(const contours_t& lines, const gdal& map,
+        const std::string& filepath,
+        const std::string& driver = "ESRI Shapefile");
+
+} // namespace gdalwrap
+
+#endif // CONTOUR_HPP
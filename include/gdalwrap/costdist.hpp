@@ -0,0 +1,54 @@
+/*
+ * costdist.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef COSTDIST_HPP
+#define COSTDIST_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+// names of the bands returned by cost_distance
+extern const std::string costdist_distance;  // "DISTANCE"
+extern const std::string costdist_direction; // "DIRECTION"
+
+/** Cost distance (travel time) field by the fast marching method
+ *
+ * Solve the eikonal equation |grad T| = cost, from the sources, with the
+ * (anisotropic) pixel scale. Cells are frozen in increasing T order using a
+ * radix heap (monotone keys, O(1) push, lazy deletion).
+ *
+ * The DIRECTION band is the back-pointer of each cell: the code d in [0,7]
+ * of the 8-neighbour of steepest descent, (dx, dy) = (1,0) (1,1) (0,1)
+ * (-1,1) (-1,0) (-1,-1) (0,-1) (1,-1), -1 for sources and unreached cells.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1] of the cost band (per meter), cells <= 0 or
+ *        NaN are obstacles.
+ * @param sources start points in UTM (or custom frame).
+ * @param goals stop as soon as all of them are reached (empty: whole map).
+ * @param custom true if points are in the custom frame.
+ * @returns DISTANCE (infinity if unreached) and DIRECTION bands.
+ */
+gdal cost_distance(const gdal& map, size_t band, const points_xy_t& sources,
+        const points_xy_t& goals = points_xy_t(), bool custom = false);
+
+/** Follow the back-pointers from a point to the closest source
+ *
+ * @param field result of cost_distance.
+ * @param from start point in UTM (or custom frame).
+ * @param custom true if from (and the result) is in the custom frame.
+ * @returns cell centers from `from` to the source, empty if unreached.
+ */
+points_xy_t trace_back(const gdal& field, const point_xy_t& from,
+        bool custom = false);
+
+} // namespace gdalwrap
+
+#endif // COSTDIST_HPP
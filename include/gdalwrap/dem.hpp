@@ -0,0 +1,49 @@
+/*
+ * dem.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef DEM_HPP
+#define DEM_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+typedef std::array<double, 3> point_xyz_t;
+typedef std::vector<point_xyz_t> points_xyz_t;
+
+// names of the statistics bands updated by add_points
+extern const std::string dem_n_points;   // "N_POINTS"
+extern const std::string dem_z_min;      // "Z_MIN"
+extern const std::string dem_z_max;      // "Z_MAX"
+extern const std::string dem_z_mean;     // "Z_MEAN"
+extern const std::string dem_z_variance; // "Z_VARIANCE" (population)
+
+/** Add (or reset) the 5 statistics bands of a DEM, set to 0
+ *
+ * @param map gdal instance, its size must be set.
+ */
+void init_dem(gdal& map);
+
+/** Bin a batch of points into the statistics bands
+ *
+ * Points are sorted by cell (radix sort), then each cell merges the
+ * statistics of its points with the current ones (Welford / Chan),
+ * cells are processed in parallel. Points outside the map are ignored.
+ *
+ * @param map gdal instance with the bands of init_dem.
+ * @param points {x, y, z} in UTM (or custom frame).
+ * @param custom true if x, y are in the custom frame.
+ * @returns number of points inside the map.
+ * @throws std::out_of_range if a statistics band is missing.
+ */
+size_t add_points(gdal& map, const points_xyz_t& points, bool custom = false);
+
+} // namespace gdalwrap
+
+#endif // DEM_HPP
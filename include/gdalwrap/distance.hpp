@@ -0,0 +1,62 @@
+/*
+ * distance.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef DISTANCE_HPP
+#define DISTANCE_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Binary mask from a band
+ *
+ * @param band raster to threshold.
+ * @param threshold cells >= threshold are set (1), others are 0.
+ * @returns mask of the same size as band.
+ */
+bytes_t threshold(const raster& band, float threshold);
+
+/** Exact Euclidean distance transform
+ *
+ * Felzenszwalb & Huttenlocher lower envelope of parabolas, in two separable
+ * passes (columns then rows), O(width * height).
+ *
+ * @param mask non-zero cells are the features (obstacles).
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param scale_x pixel width in meters (default 1.0).
+ * @param scale_y pixel height in meters (default 1.0).
+ * @returns distance to the closest feature in meters,
+ *          infinity if the mask is empty.
+ */
+raster distance_transform(const bytes_t& mask, size_t width, size_t height,
+        double scale_x = 1.0, double scale_y = 1.0);
+
+/** Exact Euclidean distance and feature transform
+ *
+ * @see distance_transform
+ * @param nearest index of the closest feature of each cell (output),
+ *        std::numeric_limits<size_t>::max() if the mask is empty.
+ */
+raster distance_transform(const bytes_t& mask, size_t width, size_t height,
+        std::vector<size_t>& nearest, double scale_x = 1.0,
+        double scale_y = 1.0);
+
+/** Exact Euclidean distance transform of a band
+ *
+ * @param map gdal instance, its scale is used to get meters.
+ * @param band number [0,n-1].
+ * @param threshold cells >= threshold are obstacles.
+ * @returns distance to the closest obstacle in meters.
+ */
+raster distance_transform(const gdal& map, size_t band, float threshold);
+
+} // namespace gdalwrap
+
+#endif // DISTANCE_HPP
@@ -0,0 +1,89 @@
+/*
+ * fill.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef FILL_HPP
+#define FILL_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Fill no-data holes with the nearest valid value
+ *
+ * One exact feature transform (see distance_transform), O(width * height).
+ *
+ * @param band raster to fill in place.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param no_data value of the holes (can be NaN).
+ * @param max_distance holes further than that (in pixels) are kept.
+ * @returns number of filled cells.
+ */
+size_t fill_nearest(raster& band, size_t width, size_t height, float no_data,
+        double max_distance = std::numeric_limits<double>::infinity());
+
+/** Fill no-data holes by inverse distance weighting
+ *
+ * Each hole is the weighted mean (1 / d^power) of the valid cells within
+ * max_distance, rows are processed in parallel. The window costs
+ * O(max_distance^2) per hole: only suitable for small radii, the radius
+ * is clamped to the raster size (e.g. infinity).
+ *
+ * @param band raster to fill in place.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param no_data value of the holes (can be NaN).
+ * @param max_distance search radius in pixels.
+ * @param power of the inverse distance (default 2).
+ * @returns number of filled cells.
+ */
+size_t fill_idw(raster& band, size_t width, size_t height, float no_data,
+        double max_distance, double power = 2);
+
+/** Fill no-data holes with a smooth (harmonic) surface
+ *
+ * Solve the Laplace equation in the holes, the valid cells being the
+ * boundary conditions: the holes are first solved on a coarse grid
+ * (recursively, each level halves the size), then refined with a few
+ * red-black Gauss-Seidel sweeps per level (parallel).
+ *
+ * @param band raster to fill in place.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param no_data value of the holes (can be NaN).
+ * @param max_distance holes further than that (in pixels) are kept.
+ * @param sweeps Gauss-Seidel iterations per level (default 8).
+ * @returns number of filled cells.
+ */
+size_t fill_laplace(raster& band, size_t width, size_t height, float no_data,
+        double max_distance = std::numeric_limits<double>::infinity(),
+        size_t sweeps = 8);
+
+enum class fill_method {nearest, idw, laplace};
+
+/** Fill the no-data holes of a band within a distance in meters
+ *
+ * e.g. sensor shadows of a DEM, larger holes are kept as no-data.
+ *
+ * @param map gdal instance, its scale is used to get pixels.
+ * @param band number [0,n-1].
+ * @param no_data value of the holes (can be NaN).
+ * @param max_distance in meters, converted with the smaller of the 2
+ *        scales (pixels are assumed square).
+ * @param method nearest, idw or laplace (default).
+ * @returns number of filled cells.
+ */
+size_t fill(gdal& map, size_t band, float no_data, double max_distance,
+        fill_method method = fill_method::laplace);
+
+} // namespace gdalwrap
+
+#endif // FILL_HPP
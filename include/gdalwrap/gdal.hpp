@@ -19,11 +19,14 @@
 #include <algorithm>  // std::minmax
 #include <stdexcept>  // std::runtime_error
 
+class GDALDataset;
+
 namespace gdalwrap {
 
 typedef std::vector<float>  raster;
 typedef std::vector<raster> rasters;
 typedef std::array<double, 2> point_xy_t;
+typedef std::vector<point_xy_t> points_xy_t;
 typedef std::array<double, 6> transform_t;
 typedef std::vector<std::string> names_t;
 typedef std::vector<uint8_t> bytes_t;
@@ -56,6 +59,8 @@ class gdal {
     double custom_z_origin; // in meters
 
     void _init();
+    // set projection, geotransform, metadata, and write the bands
+    void write(GDALDataset *dataset) const;
 
 public:
     rasters bands;
@@ -205,6 +210,14 @@ public:
         utm_north = north;
     }
 
+    int get_utm_zone() const {
+        return utm_zone;
+    }
+
+    bool get_utm_north() const {
+        return utm_north;
+    }
+
     /** Set the coefficients for transforming
      * between pixel/line (P,L) raster space,
      * and projection coordinates (Xp,Yp) space.
@@ -224,6 +237,24 @@ public:
         transform[5] = height;  // n-s pixel resolution
     }
 
+    /** Set the full affine geotransform (GDAL order)
+     *
+     * Xp = t[0] + P * t[1] + L * t[2]
+     * Yp = t[3] + P * t[4] + L * t[5]
+     *
+     * Note: the point_* and index_* helpers assume a "north up" image
+     * (t[2] == t[4] == 0), rotated grids are meant to be saved or warped.
+     *
+     * @param t the 6 coefficients.
+     */
+    void set_transform(const transform_t& t) {
+        transform = t;
+    }
+
+    const transform_t& get_transform() const {
+        return transform;
+    }
+
     /** Set raster size.
      *
      * @param n number of rasters.
@@ -325,6 +356,37 @@ public:
      */
     void save(const std::string& filepath, bool compress = false) const;
 
+    /** Save as GeoTiff with internal overviews
+     *
+     * @param filepath path to .tif file.
+     * @param overviews reduction factors, e.g. {2, 4, 8}.
+     * @param resampling GDAL overview resampling, e.g. "AVERAGE", "NEAREST",
+     *        "MODE", "MIN", "MAX" (see gdaladdo).
+     * @param compress fastest deflate (zlib/png).
+     */
+    void save(const std::string& filepath, const std::vector<int>& overviews,
+              const std::string& resampling = "AVERAGE",
+              bool compress = false) const;
+
+    /** Save as Cloud Optimized GeoTiff
+     *
+     * Tiled (blocksize x blocksize), with internal overviews down to one
+     * tile, the IFDs (headers) at the beginning of the file, so that a
+     * windowed or low resolution read needs only a few small reads.
+     * Use the GDAL COG driver (ghost area, optimized ordering) when
+     * available (GDAL >= 3.1), otherwise GTiff with COPY_SRC_OVERVIEWS:
+     * the IFDs are at the start of the file but there is no ghost area,
+     * so readers do not report LAYOUT=COG.
+     *
+     * @param filepath path to .tif file.
+     * @param resampling GDAL overview resampling, e.g. "AVERAGE".
+     * @param compress fastest deflate (zlib/png).
+     * @param blocksize tile size in pixels (default 256).
+     */
+    void save_cog(const std::string& filepath,
+                  const std::string& resampling = "AVERAGE",
+                  bool compress = false, int blocksize = 256) const;
+
     /** Load a GeoTiff
      *
      * @param filepath path to .tif file.
@@ -416,6 +478,28 @@ inline raster normalize(raster& v) {
     return v;
 }
 
+/** bilinear interpolation of a band
+ *
+ * @param band raster of width x height.
+ * @param x column, in pixel, cell centers are integers.
+ * @param y row, in pixel, cell centers are integers.
+ * @param no_data returned when (x, y) is outside the raster.
+ */
+inline float bilinear(const raster& band, size_t width, size_t height,
+        double x, double y, float no_data = 0) {
+    if ( !(x > -0.5 and y > -0.5 and x < width - 0.5 and y < height - 0.5) )
+        return no_data;
+    // clamp to the border cells
+    x = std::min(std::max(x, 0.0), width  - 1.0);
+    y = std::min(std::max(y, 0.0), height - 1.0);
+    size_t x0 = x, y0 = y;
+    size_t x1 = std::min(x0 + 1, width - 1), y1 = std::min(y0 + 1, height - 1);
+    float fx = x - x0, fy = y - y0;
+    float top = band[x0 + y0 * width] * (1 - fx) + band[x1 + y0 * width] * fx;
+    float bot = band[x0 + y1 * width] * (1 - fx) + band[x1 + y1 * width] * fx;
+    return top * (1 - fy) + bot * fy;
+}
+
 inline std::string toupper(const std::string& in) {
     std::string up(in);
     std::transform(up.begin(), up.end(), up.begin(), std::ptr_fun<int, int>(std::toupper));
@@ -0,0 +1,80 @@
+/*
+ * geographic.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef GEOGRAPHIC_HPP
+#define GEOGRAPHIC_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+class OGRCoordinateTransformation;
+
+namespace gdalwrap {
+
+/** Batch conversion between pixel/UTM/custom and WGS84 longitude/latitude
+ *
+ * The OGR coordinate transformations for the dataset UTM zone are created
+ * once and cached. Points are {x, y} in UTM/custom/pixel and {lon, lat}
+ * in degrees, converted in place.
+ *
+ * Optionally, `approximate(step)` samples the exact transformation on a grid
+ * (every `step` pixels) and the conversions to lon/lat of points inside the
+ * raster use a bilinear interpolation of that grid instead (in parallel).
+ * The error is negligible for a step of a few hundred meters in UTM.
+ */
+class wgs84 {
+    OGRCoordinateTransformation *utm2geo;
+    OGRCoordinateTransformation *geo2utm;
+    gdal meta; // geotransform, custom origin, utm zone
+    // approximation grid of lon/lat, every grid_step pixels
+    size_t grid_step;
+    size_t grid_width;
+    size_t grid_height;
+    points_xy_t grid;
+
+    void transform(OGRCoordinateTransformation *ct, points_xy_t& points) const;
+    void pix2lonlat_approx(points_xy_t& points) const;
+
+public:
+    /** Create the transformations for the UTM zone of map
+     *
+     * @param map gdal instance (UTM zone, geotransform, custom origin).
+     * @throws std::runtime_error if the transformations can not be created.
+     */
+    wgs84(const gdal& map);
+    ~wgs84();
+    wgs84(const wgs84&) = delete;
+    wgs84& operator=(const wgs84&) = delete;
+
+    /** Sample the exact transformation every step pixels (0 to disable)
+     */
+    void approximate(size_t step);
+
+    void utm2lonlat(points_xy_t& points) const;
+    void lonlat2utm(points_xy_t& points) const;
+    void pix2lonlat(points_xy_t& points) const;
+    void lonlat2pix(points_xy_t& points) const;
+    void custom2lonlat(points_xy_t& points) const;
+    void lonlat2custom(points_xy_t& points) const;
+
+    point_xy_t utm2lonlat(double x, double y) const {
+        points_xy_t p(1, point_xy_t{{x, y}});
+        utm2lonlat(p);
+        return p[0];
+    }
+
+    point_xy_t lonlat2utm(double lon, double lat) const {
+        points_xy_t p(1, point_xy_t{{lon, lat}});
+        lonlat2utm(p);
+        return p[0];
+    }
+};
+
+} // namespace gdalwrap
+
+#endif // GEOGRAPHIC_HPP
@@ -0,0 +1,110 @@
+/*
+ * hydrology.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef HYDROLOGY_HPP
+#define HYDROLOGY_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+// band names of the flow result
+extern const std::string flow_filled;       // depressionless elevation
+extern const std::string flow_direction;    // D8 code or D-infinity angle
+extern const std::string flow_accumulation; // upslope area, in cells
+
+/** Fill the pits (depressions) of a DEM by priority-flood (Barnes et al.)
+ *
+ * Cells are flooded from the border (and from no-data) in elevation
+ * order; cells below their spill elevation go through a plain FIFO queue
+ * instead of the priority queue, whose entries are packed in 64 bits.
+ *
+ * @param dem elevation band of width x height, modified in place.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param epsilon raise filled cells by one float ulp per step, so that
+ *        flats drain (needed by the flow directions), flat fill otherwise.
+ * @param no_data value of the cells to ignore (outlets).
+ * @returns number of raised cells.
+ * @throws std::invalid_argument over 2^32 cells (32 bits indices).
+ */
+size_t fill_pits(raster& dem, size_t width, size_t height,
+        bool epsilon = true,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** D8 flow direction: steepest descent among the 8 neighbours
+ *
+ * Codes 0 to 7 are E, SE, S, SW, W, NW, N, NE in pixels (y down),
+ * -1 when no neighbour is lower (pit, flat or no-data).
+ *
+ * @param dem elevation band of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param scale_x pixel width in meters.
+ * @param scale_y pixel height in meters.
+ * @param no_data value of the cells to ignore.
+ */
+raster flow_direction_d8(const raster& dem, size_t width, size_t height,
+        double scale_x = 1.0, double scale_y = 1.0,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** D-infinity flow direction (Tarboton)
+ *
+ * Steepest descent over the 8 triangular facets of each cell, as an
+ * angle in radians [0, 2 pi[ from +x towards +y (pixels, y down),
+ * -1 when no facet is downslope.
+ *
+ * @see flow_direction_d8
+ */
+raster flow_direction_dinf(const raster& dem, size_t width, size_t height,
+        double scale_x = 1.0, double scale_y = 1.0,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** Flow accumulation of a D8 direction band, O(width * height)
+ *
+ * Cells are processed in topological order (upslope first), counting the
+ * donors of each cell (Kahn), no recursion.
+ *
+ * @param direction D8 codes of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param weight runoff of each cell (1 if NULL).
+ * @returns upslope weight of each cell, itself included.
+ */
+raster flow_accumulation_d8(const raster& direction, size_t width,
+        size_t height, const raster* weight = NULL);
+
+/** Flow accumulation of a D-infinity angle band, O(width * height)
+ *
+ * The flow of a cell is split between the 2 neighbours bounding its
+ * angle, in proportion to the angle.
+ *
+ * @see flow_accumulation_d8
+ */
+raster flow_accumulation_dinf(const raster& angle, size_t width,
+        size_t height, double scale_x = 1.0, double scale_y = 1.0,
+        const raster* weight = NULL);
+
+/** Pit filling, flow direction and accumulation of an elevation band
+ *
+ * @param map gdal instance, its scale is used for the slopes.
+ * @param band number [0,n-1].
+ * @param dinf D-infinity directions (D8 otherwise).
+ * @param no_data value of the cells to ignore.
+ * @returns gdal with the bands flow_filled, flow_direction and
+ *          flow_accumulation (no_data on the no-data cells).
+ */
+gdal flow(const gdal& map, size_t band, bool dinf = false,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+} // namespace gdalwrap
+
+#endif // HYDROLOGY_HPP
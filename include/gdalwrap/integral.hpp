@@ -0,0 +1,118 @@
+/*
+ * integral.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef INTEGRAL_HPP
+#define INTEGRAL_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Summed-area table (integral image) of a band
+ *
+ * Store the sum and the sum of squares (in double) of a band, so that the
+ * sum, mean and variance of any axis-aligned window cost O(1).
+ * Values are stored minus the band mean, so that the variance of a DEM
+ * at 1500 m does not cancel out in E[x^2] - E[x]^2.
+ * Windows are inclusive and clipped to the raster.
+ */
+class integral {
+    std::vector<double> sum1; // (width + 1) * (height + 1)
+    std::vector<double> sum2; // sum of squares
+    double offset;            // band mean, subtracted from the values
+    size_t width;
+    size_t height;
+    gdal meta; // geotransform and custom origin, for utm/custom windows
+
+    // clip [x0,x1] x [y0,y1] to the raster, false if empty
+    bool clip(long& x0, long& y0, long& x1, long& y1) const;
+    // window in pixel from 2 corners in a metric frame
+    void window(const point_xy_t& a, const point_xy_t& b,
+            long& x0, long& y0, long& x1, long& y1) const;
+
+public:
+    integral() : offset(0), width(0), height(0) {}
+    integral(const raster& band, size_t width, size_t height) {
+        build(band, width, height);
+    }
+    integral(const gdal& map, size_t band) {
+        build(map, band);
+    }
+
+    /** (Re)build the tables, rows are processed in parallel.
+     *
+     * @param band raster.
+     * @param width number of columns.
+     * @param height number of rows.
+     */
+    void build(const raster& band, size_t width, size_t height);
+
+    /** Update the tables after the window [x0,x1] x [y0,y1] of the band
+     * changed, cost O((width - x0) * (height - y0)) instead of a rebuild.
+     * The offset is kept, band must have the size of the tables.
+     *
+     * @param band raster, already modified.
+     */
+    void update(const raster& band, long x0, long y0, long x1, long y1);
+
+    /** (Re)build the tables from a gdal band, keep its geotransform.
+     *
+     * @param map gdal instance.
+     * @param band number [0,n-1].
+     */
+    void build(const gdal& map, size_t band);
+
+    size_t get_width() const {
+        return width;
+    }
+
+    size_t get_height() const {
+        return height;
+    }
+
+    /** Number of cells in the window [x0,x1] x [y0,y1] (clipped)
+     */
+    size_t count(long x0, long y0, long x1, long y1) const;
+
+    /** Sum of the window [x0,x1] x [y0,y1] (in pixels, clipped)
+     */
+    double sum(long x0, long y0, long x1, long y1) const;
+
+    /** Sum of squares of the window [x0,x1] x [y0,y1] (clipped)
+     */
+    double sum_sq(long x0, long y0, long x1, long y1) const;
+
+    /** Mean of the window [x0,x1] x [y0,y1], NaN if empty
+     */
+    double mean(long x0, long y0, long x1, long y1) const;
+
+    /** Variance of the window [x0,x1] x [y0,y1], NaN if empty
+     */
+    double variance(long x0, long y0, long x1, long y1) const;
+
+    /** Mean of the window between 2 UTM corners
+     */
+    double mean_utm(double x0, double y0, double x1, double y1) const;
+
+    /** Variance of the window between 2 UTM corners
+     */
+    double variance_utm(double x0, double y0, double x1, double y1) const;
+
+    /** Mean of the window between 2 custom corners
+     */
+    double mean_custom(double x0, double y0, double x1, double y1) const;
+
+    /** Variance of the window between 2 custom corners
+     */
+    double variance_custom(double x0, double y0, double x1, double y1) const;
+};
+
+} // namespace gdalwrap
+
+#endif // INTEGRAL_HPP
@@ -0,0 +1,65 @@
+/*
+ * labeling.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef LABELING_HPP
+#define LABELING_HPP
+
+#include <cstdint>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+// label band, 0 is the background, components are numbered from 1
+typedef std::vector<uint32_t> labels_t;
+
+/** Connected component statistics (in pixels)
+ */
+struct component_t {
+    size_t area;        // number of pixels
+    size_t min_x;       // bounding box, inclusive
+    size_t min_y;
+    size_t max_x;
+    size_t max_y;
+    double centroid_x;
+    double centroid_y;
+};
+// components[label - 1]
+typedef std::vector<component_t> components_t;
+
+/** Connected component labeling
+ *
+ * Union-find on strips of rows labeled in parallel,
+ * then strip borders are merged. No recursion (no stack limit).
+ * Labels are numbered in raster scan order (deterministic).
+ *
+ * @param mask non-zero cells are the foreground.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param labels output label band (resized to width * height).
+ * @param eight 8-connectivity if true, 4-connectivity otherwise.
+ * @returns statistics of each component, labels[i] = n <=> components[n-1].
+ */
+components_t connected_components(const bytes_t& mask,
+        size_t width, size_t height, labels_t& labels, bool eight = true);
+
+/** Connected component labeling of a thresholded band
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param threshold cells >= threshold are the foreground.
+ * @param labels output label band.
+ * @param eight 8-connectivity if true, 4-connectivity otherwise.
+ */
+components_t connected_components(const gdal& map, size_t band,
+        float threshold, labels_t& labels, bool eight = true);
+
+} // namespace gdalwrap
+
+#endif // LABELING_HPP
@@ -0,0 +1,112 @@
+/*
+ * minmax.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef MINMAX_HPP
+#define MINMAX_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Min/max pyramid (quadtree of block extremes) of a band
+ *
+ * Level l stores the min and max of the blocks of 2^l x 2^l cells.
+ * A window query visits the coarsest blocks fully inside the window,
+ * and the `any_above` / `any_below` queries stop at the first match.
+ * Updating one cell costs O(log(max(width, height))).
+ * Windows are inclusive and clipped to the raster.
+ */
+class minmax {
+    std::vector<raster> lows;  // lows[0] == highs[0] == band
+    std::vector<raster> highs;
+    std::vector<size_t> widths;
+    std::vector<size_t> heights;
+    gdal meta; // geotransform and custom origin, for utm/custom windows
+
+    bool clip(long& x0, long& y0, long& x1, long& y1) const;
+    void reduce(size_t level, size_t x, size_t y);
+    // visit the window, op returns false to stop
+    template <class Op>
+    void visit(long x0, long y0, long x1, long y1, Op op) const;
+
+public:
+    minmax() {}
+    minmax(const raster& band, size_t width, size_t height) {
+        build(band, width, height);
+    }
+    minmax(const gdal& map, size_t band) {
+        build(map, band);
+    }
+
+    /** (Re)build the pyramid, each level is reduced in parallel.
+     */
+    void build(const raster& band, size_t width, size_t height);
+
+    /** (Re)build the pyramid from a gdal band, keep its geotransform.
+     */
+    void build(const gdal& map, size_t band);
+
+    /** Set a cell value and update the pyramid
+     */
+    void update(size_t x, size_t y, float value);
+
+    size_t get_width() const {
+        return widths.empty() ? 0 : widths[0];
+    }
+
+    size_t get_height() const {
+        return heights.empty() ? 0 : heights[0];
+    }
+
+    size_t get_levels() const {
+        return lows.size();
+    }
+
+    float get(size_t x, size_t y) const {
+        return lows[0][x + y * widths[0]];
+    }
+
+    /** Minimum of the window [x0,x1] x [y0,y1], NaN if empty
+     */
+    float min(long x0, long y0, long x1, long y1) const;
+
+    /** Maximum of the window [x0,x1] x [y0,y1], NaN if empty
+     */
+    float max(long x0, long y0, long x1, long y1) const;
+
+    /** Is there a cell > threshold in the window [x0,x1] x [y0,y1]
+     */
+    bool any_above(long x0, long y0, long x1, long y1, float threshold) const;
+
+    /** Is there a cell < threshold in the window [x0,x1] x [y0,y1]
+     */
+    bool any_below(long x0, long y0, long x1, long y1, float threshold) const;
+
+    /** Maximum of the window between 2 UTM corners
+     */
+    float max_utm(double x0, double y0, double x1, double y1) const;
+
+    /** Is there a cell > threshold between 2 UTM corners
+     */
+    bool any_above_utm(double x0, double y0, double x1, double y1,
+            float threshold) const;
+
+    /** Maximum of the window between 2 custom corners
+     */
+    float max_custom(double x0, double y0, double x1, double y1) const;
+
+    /** Is there a cell > threshold between 2 custom corners
+     */
+    bool any_above_custom(double x0, double y0, double x1, double y1,
+            float threshold) const;
+};
+
+} // namespace gdalwrap
+
+#endif // MINMAX_HPP
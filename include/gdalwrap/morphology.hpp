@@ -0,0 +1,84 @@
+/*
+ * morphology.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef MORPHOLOGY_HPP
+#define MORPHOLOGY_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Dilation (max filter) with a rectangular structuring element
+ *
+ * van Herk / Gil-Werman, O(1) per pixel whatever the element size.
+ *
+ * @param band raster to dilate (float or byte).
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param rx half width of the element, in pixels (size 2 * rx + 1).
+ * @param ry half height of the element, in pixels (size 2 * ry + 1).
+ */
+raster  dilate_rect(const raster&  band, size_t width, size_t height,
+                    size_t rx, size_t ry);
+bytes_t dilate_rect(const bytes_t& band, size_t width, size_t height,
+                    size_t rx, size_t ry);
+
+/** Erosion (min filter) with a rectangular structuring element
+ *
+ * @see dilate_rect
+ */
+raster  erode_rect(const raster&  band, size_t width, size_t height,
+                   size_t rx, size_t ry);
+bytes_t erode_rect(const bytes_t& band, size_t width, size_t height,
+                   size_t rx, size_t ry);
+
+/** Dilation (max filter) with an elliptic (disc) structuring element
+ *
+ * The disc is decomposed in 2 * ry + 1 horizontal runs,
+ * each run being a 1D van Herk / Gil-Werman max filter.
+ *
+ * @param band raster to dilate (float or byte).
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param rx radius along x, in pixels.
+ * @param ry radius along y, in pixels.
+ */
+raster  dilate_disc(const raster&  band, size_t width, size_t height,
+                    double rx, double ry);
+bytes_t dilate_disc(const bytes_t& band, size_t width, size_t height,
+                    double rx, double ry);
+
+/** Erosion (min filter) with an elliptic (disc) structuring element
+ *
+ * @see dilate_disc
+ */
+raster  erode_disc(const raster&  band, size_t width, size_t height,
+                   double rx, double ry);
+bytes_t erode_disc(const bytes_t& band, size_t width, size_t height,
+                   double rx, double ry);
+
+/** Inflate a band by a radius in meters (disc dilation)
+ *
+ * e.g. inflate obstacles of a costmap by the robot radius.
+ *
+ * @param map gdal instance, its scale is used to get pixels.
+ * @param band number [0,n-1].
+ * @param radius in meters.
+ */
+raster dilate(const gdal& map, size_t band, double radius);
+
+/** Shrink a band by a radius in meters (disc erosion)
+ *
+ * @see dilate
+ */
+raster erode(const gdal& map, size_t band, double radius);
+
+} // namespace gdalwrap
+
+#endif // MORPHOLOGY_HPP
@@ -0,0 +1,54 @@
+/*
+ * occupancy.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef OCCUPANCY_HPP
+#define OCCUPANCY_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Sensor ray, from the sensor origin to the hit point
+ */
+struct ray_t {
+    point_xy_t origin;
+    point_xy_t end;
+};
+typedef std::vector<ray_t> rays_t;
+
+/** Log-odds occupancy update parameters
+ */
+struct log_odds_t {
+    float hit;  // added to the end cell (> 0)
+    float miss; // added to the traversed cells (< 0)
+    float min;  // clamping
+    float max;
+};
+
+/** Trace rays through an occupancy band and update its log-odds
+ *
+ * Amanatides & Woo voxel traversal: every cell crossed by the segment
+ * gets `miss`, the end cell gets `hit` (unless `hit_end` is false, e.g.
+ * max range readings). Values are clamped to [min, max].
+ * Rays are processed in parallel, cells are updated with a lock-free CAS
+ * (see atomic.hpp) so crossing rays do not lose updates.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1] of the log-odds band.
+ * @param rays in UTM (or custom frame).
+ * @param params log-odds hit / miss and clamping.
+ * @param custom true if rays are in the custom frame.
+ * @param hit_end false to only clear the cells along the rays.
+ */
+void raycast(gdal& map, size_t band, const rays_t& rays,
+        const log_odds_t& params, bool custom = false, bool hit_end = true);
+
+} // namespace gdalwrap
+
+#endif // OCCUPANCY_HPP
@@ -0,0 +1,53 @@
+/*
+ * overview.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef OVERVIEW_HPP
+#define OVERVIEW_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** How a block of cells is reduced to one overview cell
+ */
+enum class reduction { nearest, mean, min, max, mode };
+
+/** GDAL resampling name of a reduction, for gdal::save with overviews
+ */
+std::string resampling_name(reduction method);
+
+/** Reduced resolution copy of all the bands
+ *
+ * Blocks of factor x factor cells are reduced to one cell, the last
+ * row/column blocks may be partial. The geotransform is scaled accordingly,
+ * its origin moves to the center of the first block.
+ *
+ * @param map gdal instance.
+ * @param factor reduction factor (>= 1).
+ * @param method reduction (default mean).
+ */
+gdal overview(const gdal& map, size_t factor,
+        reduction method = reduction::mean);
+
+/** Overview pyramid: factors 2, 4, 8, ... 2^levels
+ *
+ * Each level is reduced from the previous one (a cheap factor 2),
+ * except mode which always reduces the full resolution.
+ *
+ * @param map gdal instance.
+ * @param levels number of overviews.
+ * @param method reduction (default mean).
+ * @returns overviews[i] has a factor 2^(i+1).
+ */
+std::vector<gdal> overviews(const gdal& map, size_t levels,
+        reduction method = reduction::mean);
+
+} // namespace gdalwrap
+
+#endif // OVERVIEW_HPP
@@ -0,0 +1,96 @@
+/*
+ * polygon.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef POLYGON_HPP
+#define POLYGON_HPP
+
+#include <cstdint>
+
+#include "gdalwrap/gdal.hpp"
+
+class OGRGeometry;
+
+namespace gdalwrap {
+
+// rings of a polygon: exterior first, then holes (closing point optional)
+typedef std::vector<points_xy_t> polygon_t;
+typedef std::vector<polygon_t> polygons_t;
+
+/** Polygon of a label band
+ */
+struct region_t {
+    uint32_t label;
+    polygon_t rings;
+};
+typedef std::vector<region_t> regions_t;
+
+/** Rasterize polygons by scanline filling (even-odd rule)
+ *
+ * A cell is set if its center is inside. Strips of rows are processed in
+ * parallel with an active edge list each.
+ *
+ * @param band raster of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param polygons in pixels (cell centers are integers).
+ * @param value to set inside the polygons.
+ */
+void rasterize(raster& band, size_t width, size_t height,
+        const polygons_t& polygons, float value);
+
+/** Rasterize polygons in UTM or custom coordinates into a band
+ *
+ * e.g. keep-out zones into a costmap.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param polygons in UTM or custom coordinates.
+ * @param value to set inside the polygons (default 1).
+ * @param custom coordinates in the custom frame (UTM otherwise).
+ */
+void rasterize(gdal& map, size_t band, const polygons_t& polygons,
+        float value = 1, bool custom = false);
+
+/** Rasterize an OGR Polygon or MultiPolygon into a band
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param geometry in the projection of map (UTM).
+ * @param value to set inside the geometry (default 1).
+ * @throws std::invalid_argument if geometry is not a (multi) polygon.
+ */
+void rasterize(gdal& map, size_t band, const OGRGeometry* geometry,
+        float value = 1);
+
+/** Polygonize a label band by boundary edge chaining
+ *
+ * One region per 4-connected area of a same non-zero label, its rings
+ * follow the cell borders (collinear points are removed), O(width *
+ * height). Exterior rings are clockwise in pixels (y down), holes are
+ * counter-clockwise; rings are closed (last point == first point).
+ *
+ * @param labels label band of width x height, 0 is the background.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @returns regions in pixels (cell centers are integers).
+ */
+regions_t polygonize(const std::vector<uint32_t>& labels, size_t width,
+        size_t height);
+
+/** Polygonize a gdal label band in UTM or custom coordinates
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1], values are rounded to labels.
+ * @param custom coordinates in the custom frame (UTM otherwise).
+ */
+regions_t polygonize(const gdal& map, size_t band, bool custom = false);
+
+} // namespace gdalwrap
+
+#endif // POLYGON_HPP
@@ -0,0 +1,44 @@
+/*
+ * profile.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Sample a band along a polyline (bilinear)
+ *
+ * Samples are taken every `step` meters of curvilinear abscissa from the
+ * first vertex, plus the last vertex (once, even when the length is a
+ * multiple of step up to rounding). Vertices are converted to pixel
+ * once, then each segment is walked incrementally.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param polyline vertices in UTM (or custom frame).
+ * @param step distance between samples in meters (> 0).
+ * @param custom true if vertices are in the custom frame.
+ * @param no_data value of the samples outside the raster.
+ */
+raster profile(const gdal& map, size_t band, const points_xy_t& polyline,
+        double step, bool custom = false, float no_data = 0);
+
+/** Sample a band along many polylines, in parallel
+ *
+ * @see profile
+ */
+rasters profiles(const gdal& map, size_t band,
+        const std::vector<points_xy_t>& polylines, double step,
+        bool custom = false, float no_data = 0);
+
+} // namespace gdalwrap
+
+#endif // PROFILE_HPP
@@ -0,0 +1,118 @@
+/*
+ * radix_heap.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <cstdint>
+#include <cstring>  // std::memcpy
+#include <utility>  // std::pair
+
+namespace gdalwrap {
+
+/** Monotone priority queue on non-negative float keys (radix heap)
+ *
+ * Keys are bucketed by the highest bit that differs from the last popped
+ * key, so push is O(1) and pop is amortized O(log range), on plain
+ * vectors. Only valid when popped keys never decrease (Dijkstra, FMM,
+ * A* with a consistent heuristic): a key below the last popped one is a
+ * caller bug (asserted), only float rounding is tolerated and clamped.
+ * Use a binary heap for non-monotone searches such as Theta*. `clear`
+ * keeps the memory for reuse.
+ */
+template <class V>
+class radix_heap {
+    typedef std::pair<uint32_t, V> item_t;
+    std::vector<item_t> buckets[33];
+    uint32_t last;
+    size_t count;
+
+    static uint32_t bits(float key) {
+        uint32_t u;
+        std::memcpy(&u, &key, sizeof(u));
+        return u; // monotone for non-negative floats
+    }
+    static float key(uint32_t u) {
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+    size_t bucket(uint32_t u) const {
+        return (u == last) ? 0 : 32 - __builtin_clz(u ^ last);
+    }
+    void pull() {
+        if ( !buckets[0].empty() )
+            return;
+        size_t i = 1;
+        while (buckets[i].empty())
+            i++;
+        uint32_t lo = std::numeric_limits<uint32_t>::max();
+        for (const auto& it : buckets[i])
+            if (it.first < lo)
+                lo = it.first;
+        last = lo;
+        for (const auto& it : buckets[i])
+            buckets[bucket(it.first)].push_back(it);
+        buckets[i].clear();
+    }
+
+public:
+    radix_heap() : last(0), count(0) {}
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    void clear() {
+        for (auto& b : buckets)
+            b.clear();
+        last = 0;
+        count = 0;
+    }
+
+    void push(float k, const V& value) {
+        uint32_t u = bits(k > 0 ? k : 0);
+        assert(key(u) >= key(last) * (1 - 1e-5f) && "non-monotone key");
+        if (u < last)
+            u = last;
+        buckets[bucket(u)].push_back(item_t(u, value));
+        count++;
+    }
+
+    /** smallest key, the heap must not be empty
+     */
+    float top_key() {
+        pull();
+        return key(buckets[0].back().first);
+    }
+
+    /** value of the smallest key, the heap must not be empty
+     */
+    const V& top() {
+        pull();
+        return buckets[0].back().second;
+    }
+
+    void pop() {
+        pull();
+        buckets[0].pop_back();
+        count--;
+    }
+};
+
+} // namespace gdalwrap
+
+#endif // RADIX_HEAP_HPP
@@ -0,0 +1,71 @@
+/*
+ * registration.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef REGISTRATION_HPP
+#define REGISTRATION_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Translation between two rasters of the same size by phase correlation
+ *
+ * Both rasters are centered and multiplied by a Hann window, zero padded
+ * to a power of 2, then the peak of the inverse FFT of the normalized
+ * cross-power spectrum is refined to sub-pixel from its 2 neighbours
+ * (sinc model for sharp peaks, parabola for wide ones). The normalization
+ * is regularized with 1e-3 of the strongest frequency, so that smooth
+ * rasters keep a clean peak.
+ * Cells equal to no_data (or NaN) are replaced by the mean.
+ *
+ * @param reference raster of width x height.
+ * @param moving raster of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param no_data value to ignore.
+ * @param peak output height of the correlation peak in [0,1] (confidence).
+ * @returns shift (x, y) in pixels, moving(p + shift) ~ reference(p).
+ */
+point_xy_t phase_correlation(const raster& reference, const raster& moving,
+        size_t width, size_t height,
+        float no_data = std::numeric_limits<float>::quiet_NaN(),
+        double* peak = nullptr);
+
+/** Translation of a survey with respect to a reference (in UTM)
+ *
+ * The moving band is sampled on the grid of the reference, in the overlap
+ * of both extents, then registered with phase_correlation.
+ * Only translations are estimated: rotation and scale are assumed to be
+ * corrected by the georeferencing.
+ *
+ * e.g. correct the drift before merge:
+ *   point_xy_t t = register_translation(ref, 0, tile, 0);
+ *   tile.set_transform(tile.get_utm_pose_x() + t[0],
+ *       tile.get_utm_pose_y() + t[1], tile.get_scale_x(),
+ *       tile.get_scale_y());
+ *
+ * @param reference gdal instance.
+ * @param band_reference band number in reference.
+ * @param moving gdal instance.
+ * @param band_moving band number in moving.
+ * @param no_data value to ignore.
+ * @param peak output height of the correlation peak in [0,1].
+ * @returns offset to add to the UTM origin of moving, (0, 0) if the
+ *          extents do not overlap.
+ */
+point_xy_t register_translation(const gdal& reference, size_t band_reference,
+        const gdal& moving, size_t band_moving,
+        float no_data = std::numeric_limits<float>::quiet_NaN(),
+        double* peak = nullptr);
+
+} // namespace gdalwrap
+
+#endif // REGISTRATION_HPP
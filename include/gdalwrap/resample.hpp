@@ -0,0 +1,72 @@
+/*
+ * resample.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef RESAMPLE_HPP
+#define RESAMPLE_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Resampling kernel
+ *
+ * area is the exact average of the covered cells (for downsampling).
+ */
+enum class interpolation { nearest, bilinear, bicubic, lanczos, area };
+
+/** Resize a band
+ *
+ * Separable: rows are filtered horizontally then combined vertically,
+ * with precomputed weights; the kernel support is stretched when
+ * downsampling (antialiasing). Rows are processed in parallel.
+ *
+ * @param band raster of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param new_width target number of columns.
+ * @param new_height target number of rows.
+ * @param method kernel (default bilinear).
+ */
+raster resize(const raster& band, size_t width, size_t height,
+        size_t new_width, size_t new_height,
+        interpolation method = interpolation::bilinear);
+
+/** Resize all the bands, and update the geotransform
+ *
+ * The extent is kept: the scale is multiplied by the size ratio and the
+ * origin (center of the cell 0, see index_pix) moves accordingly.
+ *
+ * @param map gdal instance.
+ * @param width target number of columns.
+ * @param height target number of rows.
+ * @param method kernel (default bilinear).
+ * @throws std::invalid_argument if width or height is 0.
+ */
+gdal resize(const gdal& map, size_t width, size_t height,
+        interpolation method = interpolation::bilinear);
+
+/** Resample all the bands to a resolution, e.g. 5 cm to 1 m
+ *
+ * Samples are exactly scale_x / scale_y apart, as written in the
+ * geotransform; the extent starts at the same corner and is rounded to
+ * the closest number of cells (border cells are clamped).
+ *
+ * @param map gdal instance.
+ * @param scale_x target pixel width in meters (sign ignored).
+ * @param scale_y target pixel height in meters (sign ignored, the map's
+ *        signs are kept).
+ * @param method kernel (default bilinear).
+ * @throws std::invalid_argument if a scale is 0.
+ */
+gdal resample(const gdal& map, double scale_x, double scale_y,
+        interpolation method = interpolation::bilinear);
+
+} // namespace gdalwrap
+
+#endif // RESAMPLE_HPP
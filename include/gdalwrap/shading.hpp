@@ -0,0 +1,75 @@
+/*
+ * shading.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef SHADING_HPP
+#define SHADING_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+// band names of the normals result, in the map frame (east, north, up)
+extern const std::string normal_x;
+extern const std::string normal_y;
+extern const std::string normal_z;
+
+/** Surface normals of an elevation band
+ *
+ * Horn gradient (3x3 stencil, borders clamped) in one pass, rows in
+ * parallel, the inner loop is branch free so that it vectorizes.
+ * No-data should be NaN, it propagates to the neighbours.
+ *
+ * @param map gdal instance, its signed scale gives east and north.
+ * @param band number [0,n-1].
+ * @param z_factor vertical exaggeration (default 1).
+ * @returns gdal with the bands normal_x, normal_y and normal_z (unit).
+ */
+gdal normals(const gdal& map, size_t band, float z_factor = 1);
+
+/** Normal map as bytes, ready for export8u
+ *
+ * e.g. map.export8u("normals.png", normal_map(map, 0), "PNG");
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1].
+ * @param octahedral 2 bands (octahedral encoding) instead of 3 (RGB).
+ * @param z_factor vertical exaggeration (default 1).
+ * @returns 3 bands (x, y, z) or 2 bands (u, v), each in [0,1] * 255.
+ */
+std::vector<bytes_t> normal_map(const gdal& map, size_t band,
+        bool octahedral = false, float z_factor = 1);
+
+/** Hillshade of an elevation band
+ *
+ * Lambertian shading of the Horn gradient (same stencil as normals),
+ * 0 in the shadow and on NaN.
+ *
+ * @param dem elevation band of width x height.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param scale_x pixel width (signed, see gdal::get_scale_x).
+ * @param scale_y pixel height (signed, see gdal::get_scale_y).
+ * @param azimuth of the light in degrees, clockwise from north.
+ * @param altitude of the light in degrees above the horizon.
+ * @param z_factor vertical exaggeration (default 1).
+ */
+bytes_t hillshade(const raster& dem, size_t width, size_t height,
+        double scale_x, double scale_y, double azimuth = 315,
+        double altitude = 45, float z_factor = 1);
+
+/** Hillshade of a gdal band, ready for export8u
+ *
+ * e.g. map.export8u("shade.png", { hillshade(map, 0) }, "PNG");
+ */
+bytes_t hillshade(const gdal& map, size_t band, double azimuth = 315,
+        double altitude = 45, float z_factor = 1);
+
+} // namespace gdalwrap
+
+#endif // SHADING_HPP
@@ -0,0 +1,79 @@
+/*
+ * smoothing.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef SMOOTHING_HPP
+#define SMOOTHING_HPP
+
+#include <limits>
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Guided filter (He et al.), O(width * height) whatever the radius
+ *
+ * Locally fit band ~ a * guide + b in (2 radius + 1)^2 windows, with the
+ * box means computed by separable running sums, in double on values
+ * centered on the band means (no loss at high elevations): flat areas
+ * (variance << eps) are averaged, edges (variance >> eps) are kept.
+ *
+ * @param band raster to smooth.
+ * @param guide raster of the same size (can be band itself).
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param radius of the window in pixels.
+ * @param eps regularization, in squared band unit (e.g. 0.05^2 m^2).
+ */
+raster guided_filter(const raster& band, const raster& guide,
+        size_t width, size_t height, size_t radius, double eps);
+
+/** Bilateral filter approximated on a bilateral grid (Paris & Durand)
+ *
+ * Values are splatted in a (x / sigma_space, y / sigma_space,
+ * z / sigma_range) grid, blurred there and sliced back by trilinear
+ * interpolation: the cost does not depend on sigma_space. The splat is
+ * done by grid rows in parallel. The grid is capped at 2^26 cells
+ * (512 MB): over it, e.g. with a large relief or an outlier for a small
+ * sigma_range, the sigmas are increased and a warning gives them.
+ * Cells equal to no_data (or NaN) are ignored and kept.
+ *
+ * @param band raster to smooth.
+ * @param width number of columns.
+ * @param height number of rows.
+ * @param sigma_space in pixels.
+ * @param sigma_range in band unit (e.g. 0.1 m).
+ * @param no_data value to ignore (default NaN).
+ */
+raster bilateral_filter(const raster& band, size_t width, size_t height,
+        double sigma_space, double sigma_range,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+/** Self-guided filter of a band with a radius in meters
+ *
+ * @param map gdal instance, its scale is used to get pixels.
+ * @param band number [0,n-1].
+ * @param radius in meters.
+ * @param eps regularization, in squared band unit.
+ */
+raster guided_filter(const gdal& map, size_t band, double radius, double eps);
+
+/** Bilateral filter of a band with a spatial sigma in meters
+ *
+ * @param map gdal instance, its scale is used to get pixels.
+ * @param band number [0,n-1].
+ * @param sigma_space in meters.
+ * @param sigma_range in band unit.
+ * @param no_data value to ignore (default NaN).
+ */
+raster bilateral_filter(const gdal& map, size_t band, double sigma_space,
+        double sigma_range,
+        float no_data = std::numeric_limits<float>::quiet_NaN());
+
+} // namespace gdalwrap
+
+#endif // SMOOTHING_HPP
@@ -0,0 +1,60 @@
+/*
+ * visibility.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef VISIBILITY_HPP
+#define VISIBILITY_HPP
+
+#include <limits>
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Line of sight between two points over an elevation band
+ *
+ * The elevation is sampled (bilinear) every cell along the segment.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1] of the elevation band.
+ * @param from observer position in UTM (or custom frame).
+ * @param from_height observer height above the ground.
+ * @param to target position in UTM (or custom frame).
+ * @param to_height target height above the ground.
+ * @param custom true if points are in the custom frame.
+ * @returns true if nothing is above the line of sight.
+ */
+bool line_of_sight(const gdal& map, size_t band,
+        const point_xy_t& from, double from_height,
+        const point_xy_t& to, double to_height, bool custom = false);
+
+/** Viewshed of an observer over an elevation band (R2 sweep)
+ *
+ * One ray is cast from the observer to each cell of the perimeter of the
+ * area of interest, keeping the maximum slope seen so far: a cell is
+ * visible if its target slope is above it. Rays (sectors) are processed
+ * in parallel.
+ *
+ * @param map gdal instance.
+ * @param band number [0,n-1] of the elevation band.
+ * @param observer position in UTM (or custom frame).
+ * @param observer_height above the ground.
+ * @param target_height above the ground (default 0).
+ * @param max_distance in meters (default infinity).
+ * @param custom true if observer is in the custom frame.
+ * @returns 1 for visible cells, 0 otherwise.
+ */
+raster viewshed(const gdal& map, size_t band,
+        const point_xy_t& observer, double observer_height,
+        double target_height = 0,
+        double max_distance = std::numeric_limits<double>::infinity(),
+        bool custom = false);
+
+} // namespace gdalwrap
+
+#endif // VISIBILITY_HPP
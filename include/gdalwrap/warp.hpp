@@ -0,0 +1,53 @@
+/*
+ * warp.hpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+#ifndef WARP_HPP
+#define WARP_HPP
+
+#include "gdalwrap/gdal.hpp"
+
+namespace gdalwrap {
+
+/** Geotransform of a heading aligned grid
+ *
+ * Columns go forward (along the heading), rows go to the right,
+ * so that heading 0 (east) gives a "north up" image. As everywhere in
+ * gdalwrap, the origin of the transform is the center of the first cell.
+ *
+ * @param x center of the grid, UTM x.
+ * @param y center of the grid, UTM y.
+ * @param heading in radian, counter-clockwise from the x axis (east).
+ * @param resolution pixel size in meters.
+ * @param width number of columns.
+ * @param height number of rows.
+ */
+transform_t heading_transform(double x, double y, double heading,
+        double resolution, size_t width, size_t height);
+
+/** Warp all the bands into another grid (bilinear)
+ *
+ * The destination grid is any affine geotransform (rotation, scale,
+ * translation). Source and destination transforms compose into a single
+ * affine map, so each row is a linear walk in the source (no division).
+ * Both transforms put cell centers at integer pixel coordinates (see
+ * gdal::point_pix2utm): a destination grid equal to the source gives the
+ * source values back. Rows are processed in parallel.
+ *
+ * @param map source gdal instance.
+ * @param transform destination geotransform (GDAL order).
+ * @param width destination number of columns.
+ * @param height destination number of rows.
+ * @param no_data value of the cells outside the source.
+ */
+gdal warp(const gdal& map, const transform_t& transform,
+        size_t width, size_t height, float no_data = 0);
+
+} // namespace gdalwrap
+
+#endif // WARP_HPP
@@ -0,0 +1,206 @@
+/*
+ * astar.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <functional> // std::greater
+#include "gdalwrap/astar.hpp"
+
+namespace gdalwrap {
+
+static const int dx8[8] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+static const int dy8[8] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+static inline bool free_cell(float c) {
+    return c > 0; // false for NaN
+}
+
+/** cost of the straight segment between the centers of cells a and b,
+ * integrated cell by cell (Amanatides & Woo), infinity if blocked
+ */
+static float segment_cost(const raster& cost, long width,
+        long ax, long ay, long bx, long by, double hx, double hy) {
+    double dx = bx - ax, dy = by - ay;
+    double length = std::hypot(dx * hx, dy * hy);
+    if (length == 0)
+        return 0;
+    const double inf = std::numeric_limits<double>::infinity();
+    long x = ax, y = ay, sx = dx > 0 ? 1 : -1, sy = dy > 0 ? 1 : -1;
+    // from a cell center, the first boundary is half a cell away
+    double tdx = dx != 0 ? std::abs(1 / dx) : inf,
+           tdy = dy != 0 ? std::abs(1 / dy) : inf;
+    double tx = tdx / 2, ty = tdy / 2, t = 0, total = 0;
+    while (true) {
+        float c = cost[x + y * width];
+        if ( !free_cell(c) )
+            return inf;
+        double next = std::min(std::min(tx, ty), 1.0);
+        total += (next - t) * length * c;
+        t = next;
+        if (t >= 1)
+            break;
+        if (tx < ty) {
+            x += sx;
+            tx += tdx;
+        } else if (ty < tx) {
+            y += sy;
+            ty += tdy;
+        } else { // through a corner: both side cells must be free
+            if ( !free_cell(cost[x + sx + y * width]) or
+                 !free_cell(cost[x + (y + sy) * width]) )
+                return inf;
+            x += sx;
+            y += sy;
+            tx += tdx;
+            ty += tdy;
+        }
+    }
+    return total;
+}
+
+void astar::reserve(size_t size) {
+    if (g.size() != size) {
+        g.assign(size, 0);
+        parent.assign(size, 0);
+        stamp.assign(size, 0);
+        query = 0;
+    }
+    closed.assign((size + 63) / 64, 0);
+    open.clear();
+    open_any.clear();
+    if (++query == 0) { // stamp overflow
+        std::fill(stamp.begin(), stamp.end(), 0);
+        query = 1;
+    }
+}
+
+points_xy_t astar::plan(const gdal& map, size_t band,
+        const point_xy_t& start, const point_xy_t& goal,
+        bool custom, bool any_angle, float min_cost) {
+    const raster& costs = map.bands[band];
+    const long width = map.get_width(), height = map.get_height();
+    const double hx = std::abs(map.get_scale_x()),
+                 hy = std::abs(map.get_scale_y());
+    const size_t none = std::numeric_limits<size_t>::max();
+    cost = std::numeric_limits<float>::infinity();
+    points_xy_t path;
+
+    size_t s = custom ? map.index_custom(start[0], start[1])
+                      : map.index_utm(start[0], start[1]);
+    size_t e = custom ? map.index_custom(goal[0], goal[1])
+                      : map.index_utm(goal[0], goal[1]);
+    if (s == none or e == none or !free_cell(costs[s]) or
+            !free_cell(costs[e]))
+        return path;
+    if ( !(min_cost > 0) ) {
+        if (min_band != costs.data() or min_size != costs.size()) {
+            float lo = std::numeric_limits<float>::max();
+            #pragma omp parallel for reduction(min:lo)
+            for (long i = 0; i < long(costs.size()); i++)
+                if (free_cell(costs[i]) and costs[i] < lo)
+                    lo = costs[i];
+            min_band = costs.data();
+            min_size = costs.size();
+            min_value = lo;
+        }
+        min_cost = min_value;
+    }
+    double length[8];
+    for (int d = 0; d < 8; d++)
+        length[d] = std::hypot(dx8[d] * hx, dy8[d] * hy);
+    const long ex = e % width, ey = e / width;
+    // consistent heuristics: octile (A*) or euclidean (Theta*) lower bound;
+    // octile on anisotropic pixels: min(nx, ny) diagonal steps, then the
+    // remaining straight steps at the size of their own axis
+    auto heuristic = [&](long x, long y) -> float {
+        long nx = std::abs(x - ex), ny = std::abs(y - ey);
+        if (any_angle)
+            return min_cost * std::hypot(nx * hx, ny * hy);
+        long nd = std::min(nx, ny);
+        return min_cost * (nd * length[1] + (nx - nd) * hx + (ny - nd) * hy);
+    };
+    typedef std::pair<float, uint32_t> item_t;
+    std::greater<item_t> later;
+    auto push = [&](float key, size_t i) {
+        if (any_angle) {
+            open_any.push_back(item_t(key, i));
+            std::push_heap(open_any.begin(), open_any.end(), later);
+        } else
+            open.push(key, i);
+    };
+
+    reserve(width * height);
+    g[s] = 0;
+    parent[s] = s;
+    stamp[s] = query;
+    push(heuristic(s % width, s / width), s);
+    while (any_angle ? !open_any.empty() : !open.empty()) {
+        size_t i;
+        if (any_angle) {
+            std::pop_heap(open_any.begin(), open_any.end(), later);
+            i = open_any.back().second;
+            open_any.pop_back();
+        } else {
+            i = open.top();
+            open.pop();
+        }
+        if (is_closed(i))
+            continue; // outdated entry (lazy deletion)
+        set_closed(i);
+        if (i == e)
+            break;
+        long x = i % width, y = i / width;
+        size_t pi = parent[i];
+        long px = pi % width, py = pi / width;
+        for (int d = 0; d < 8; d++) {
+            long nx = x + dx8[d], ny = y + dy8[d];
+            if (nx < 0 or ny < 0 or nx >= width or ny >= height)
+                continue;
+            size_t n = nx + ny * width;
+            if (is_closed(n) or !free_cell(costs[n]))
+                continue;
+            // no corner cutting
+            if (dx8[d] and dy8[d] and (!free_cell(costs[x + ny * width]) or
+                                       !free_cell(costs[nx + y * width])))
+                continue;
+            size_t from = i;
+            float value = g[i] + length[d] * (costs[i] + costs[n]) / 2;
+            if (any_angle and pi != i) {
+                float direct = g[pi] + segment_cost(costs, width,
+                    px, py, nx, ny, hx, hy);
+                if (direct <= value) {
+                    value = direct;
+                    from = pi;
+                }
+            }
+            if (stamp[n] != query or value < g[n]) {
+                stamp[n] = query;
+                g[n] = value;
+                parent[n] = from;
+                push(value + heuristic(nx, ny), n);
+            }
+        }
+    }
+    if ( !is_closed(e) )
+        return path;
+    cost = g[e];
+    for (size_t i = e; ; i = parent[i]) {
+        long x = i % width, y = i / width;
+        path.push_back(custom ? map.point_pix2custom(x, y)
+                              : map.point_pix2utm(x, y));
+        if (i == s)
+            break;
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+} // namespace gdalwrap
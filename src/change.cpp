@@ -0,0 +1,99 @@
+/*
+ * change.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "gdalwrap/change.hpp"
+
+namespace gdalwrap {
+
+const std::string change_difference = "DIFFERENCE";
+const std::string change_mask       = "CHANGED";
+
+gdal change_detection(const gdal& before, size_t band_before,
+        const gdal& after, size_t band_after, float threshold,
+        labels_t& labels, components_t& components, float no_data,
+        bool interpolate) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const raster& b = before.bands[band_before];
+    const raster& a = after.bands[band_after];
+    const long bw = before.get_width(), bh = before.get_height();
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    // extent of before in the pixel frame of after (cell borders)
+    point_xy_t c0 = before.point_pix2utm(-0.5, -0.5);
+    point_xy_t c1 = before.point_pix2utm(bw - 0.5, bh - 0.5);
+    point_xy_t p0 = after.point_utm2pix(c0[0], c0[1]);
+    point_xy_t p1 = after.point_utm2pix(c1[0], c1[1]);
+    long x0 = std::max(0.0, std::ceil(std::min(p0[0], p1[0]) - 0.5)),
+         y0 = std::max(0.0, std::ceil(std::min(p0[1], p1[1]) - 0.5)),
+         x1 = std::min(after.get_width() - 1.0,
+                       std::floor(std::max(p0[0], p1[0]) - 0.5)),
+         y1 = std::min(after.get_height() - 1.0,
+                       std::floor(std::max(p0[1], p1[1]) - 0.5));
+
+    gdal result;
+    result.copy_meta_only(after);
+    labels.clear();
+    components.clear();
+    if (x1 < x0 or y1 < y0) {
+        result.set_size(2, 0, 0);
+        result.names = { change_difference, change_mask };
+        return result;
+    }
+    const long width = x1 - x0 + 1, height = y1 - y0 + 1;
+    point_xy_t origin = after.point_pix2utm(x0, y0);
+    result.set_transform(origin[0], origin[1], after.get_scale_x(),
+        after.get_scale_y());
+    result.set_size(2, width, height);
+    result.names = { change_difference, change_mask };
+    raster& difference = result.bands[0];
+    raster& changed    = result.bands[1];
+    bytes_t mask(width * height);
+
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < height; y++) {
+        for (long x = 0; x < width; x++) {
+            size_t i = x + y * width;
+            float va = a[(x + x0) + (y + y0) * after.get_width()];
+            point_xy_t utm = after.point_pix2utm(x + x0, y + y0);
+            point_xy_t p = before.point_utm2pix(utm[0], utm[1]);
+            float vb = nan;
+            size_t k = before.index_pix(p);
+            if (k != std::numeric_limits<size_t>::max())
+                vb = b[k];
+            if (interpolate) {
+                // bilinear only if the 4 neighbours are valid
+                long px = std::floor(p[0]), py = std::floor(p[1]);
+                if (px >= 0 and py >= 0 and px + 1 < bw and py + 1 < bh) {
+                    size_t j = px + py * bw;
+                    if (valid(b[j]) and valid(b[j + 1]) and
+                        valid(b[j + bw]) and valid(b[j + bw + 1]))
+                        vb = bilinear(b, bw, bh, p[0], p[1]);
+                }
+            }
+            if (valid(va) and valid(vb)) {
+                float d = va - vb;
+                difference[i] = d;
+                mask[i] = std::abs(d) >= threshold;
+            } else {
+                difference[i] = nan;
+                mask[i] = 0;
+            }
+            changed[i] = mask[i];
+        }
+    }
+    components = connected_components(mask, width, height, labels);
+    return result;
+}
+
+} // namespace gdalwrap
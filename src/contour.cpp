@@ -0,0 +1,229 @@
+/*
+ * contour.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>        // for runtime_error
+#include <ogrsf_frmts.h>    // for GDALDataset, OGRLayer
+#include <ogr_spatialref.h> // for OGRSpatialReference
+
+#include "gdalwrap/contour.hpp"
+
+namespace gdalwrap {
+
+/* Square corners: v0 (x, y), v1 (x + 1, y), v2 (x + 1, y + 1), v3 (x, y + 1)
+ * and edges: e0 top (v0 v1), e1 right (v1 v2), e2 bottom (v3 v2),
+ * e3 left (v0 v3). Grid edges are numbered 2 * (x + y * width) for the
+ * horizontal edge from (x, y), + 1 for the vertical one.
+ * segments[case] lists pairs of square edges, -1 terminated;
+ * saddles (5, 10) are resolved in marching().
+ */
+static const int segments[16][5] = {
+    {-1}, {3, 0, -1}, {0, 1, -1}, {3, 1, -1},
+    {1, 2, -1}, {-1}, {0, 2, -1}, {3, 2, -1},
+    {2, 3, -1}, {0, 2, -1}, {-1}, {1, 2, -1},
+    {1, 3, -1}, {0, 1, -1}, {3, 0, -1}, {-1},
+};
+
+typedef std::pair<size_t, size_t> segment_t; // 2 grid edges
+
+static size_t grid_edge(size_t x, size_t y, size_t width, int edge) {
+    switch (edge) {
+    case 0:  return 2 * (x + y * width);
+    case 1:  return 2 * (x + 1 + y * width) + 1;
+    case 2:  return 2 * (x + (y + 1) * width);
+    default: return 2 * (x + y * width) + 1;
+    }
+}
+
+/** segments of a level, rows in parallel */
+static std::vector<segment_t> marching(const raster& band, size_t width,
+        size_t height, float level, float no_data) {
+    std::vector<std::vector<segment_t>> rows(height > 0 ? height - 1 : 0);
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long y = 0; y < long(rows.size()); y++) {
+        std::vector<segment_t>& row = rows[y];
+        for (size_t x = 0; x + 1 < width; x++) {
+            size_t i = x + y * width;
+            float v[4] = { band[i], band[i + 1], band[i + 1 + width],
+                           band[i + width] };
+            if (!valid(v[0]) or !valid(v[1]) or !valid(v[2]) or
+                !valid(v[3]))
+                continue;
+            int c = (v[0] >= level) | (v[1] >= level) << 1 |
+                    (v[2] >= level) << 2 | (v[3] >= level) << 3;
+            if (c == 5 or c == 10) {
+                // saddle: high corners are connected if the center is high
+                bool high = (v[0] + v[1] + v[2] + v[3]) / 4 >= level;
+                bool cut13 = (c == 5) == high; // cut corners v1 and v3
+                int pairs[2][2] = { {0, 1}, {2, 3} };
+                if (!cut13) {
+                    pairs[0][0] = 3; pairs[0][1] = 0;
+                    pairs[1][0] = 1; pairs[1][1] = 2;
+                }
+                for (int k = 0; k < 2; k++)
+                    row.push_back(segment_t(
+                        grid_edge(x, y, width, pairs[k][0]),
+                        grid_edge(x, y, width, pairs[k][1])));
+                continue;
+            }
+            for (const int *s = segments[c]; *s >= 0; s += 2)
+                row.push_back(segment_t(grid_edge(x, y, width, s[0]),
+                                        grid_edge(x, y, width, s[1])));
+        }
+    }
+    std::vector<segment_t> all;
+    for (const auto& row : rows)
+        all.insert(all.end(), row.begin(), row.end());
+    return all;
+}
+
+/** chain the segments sharing a grid edge into polylines */
+static void stitch(const std::vector<segment_t>& segs, const raster& band,
+        size_t width, float level, contours_t& result) {
+    const size_t none = std::numeric_limits<size_t>::max();
+    size_t n = segs.size();
+    // ends 2 s and 2 s + 1 of segment s, sorted by grid edge
+    std::vector<std::pair<size_t, size_t>> ends(2 * n);
+    for (size_t s = 0; s < n; s++) {
+        ends[2 * s]     = std::make_pair(segs[s].first,  2 * s);
+        ends[2 * s + 1] = std::make_pair(segs[s].second, 2 * s + 1);
+    }
+    std::sort(ends.begin(), ends.end());
+    // an edge is shared by at most 2 squares
+    std::vector<size_t> link(2 * n, none);
+    for (size_t k = 0; k + 1 < ends.size(); k++)
+        if (ends[k].first == ends[k + 1].first) {
+            link[ends[k].second] = ends[k + 1].second;
+            link[ends[k + 1].second] = ends[k].second;
+        }
+    auto edge_of = [&](size_t e) {
+        return (e & 1) ? segs[e / 2].second : segs[e / 2].first;
+    };
+    auto point = [&](size_t edge) {
+        size_t i = edge / 2, x = i % width, y = i / width;
+        size_t j = (edge & 1) ? i + width : i + 1;
+        float a = band[i], b = band[j];
+        double t = (a == b) ? 0.5 : (level - a) / (b - a);
+        point_xy_t p = {{ double(x), double(y) }};
+        p[(edge & 1) ? 1 : 0] += t;
+        return p;
+    };
+    std::vector<bool> done(n, false);
+    auto walk = [&](size_t start) {
+        contour_t line;
+        line.level = level;
+        line.closed = false;
+        line.points.push_back(point(edge_of(start)));
+        size_t e = start;
+        while (true) {
+            done[e / 2] = true;
+            size_t other = e ^ 1;
+            line.points.push_back(point(edge_of(other)));
+            size_t next = link[other];
+            if (next == none)
+                break;
+            if (done[next / 2]) {
+                line.closed = true;
+                break;
+            }
+            e = next;
+        }
+        result.push_back(line);
+    };
+    // open lines start from a free end, then the remaining are loops
+    for (size_t e = 0; e < 2 * n; e++)
+        if (!done[e / 2] and link[e] == none)
+            walk(e);
+    for (size_t s = 0; s < n; s++)
+        if (!done[s])
+            walk(2 * s);
+}
+
+contours_t contours(const raster& band, size_t width, size_t height,
+        const std::vector<float>& levels, float no_data) {
+    std::vector<std::vector<segment_t>> segs(levels.size());
+    for (size_t l = 0; l < levels.size(); l++)
+        segs[l] = marching(band, width, height, levels[l], no_data);
+    // levels are independent: stitch them in parallel
+    std::vector<contours_t> lines(levels.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (long l = 0; l < long(levels.size()); l++)
+        stitch(segs[l], band, width, levels[l], lines[l]);
+    contours_t result;
+    for (const auto& level : lines)
+        result.insert(result.end(), level.begin(), level.end());
+    return result;
+}
+
+contours_t contours(const gdal& map, size_t band,
+        const std::vector<float>& levels, bool custom, float no_data) {
+    contours_t result = contours(map.bands[band], map.get_width(),
+        map.get_height(), levels, no_data);
+    #pragma omp parallel for schedule(dynamic)
+    for (long k = 0; k < long(result.size()); k++)
+        for (auto& p : result[k].points)
+            p = custom ? map.point_pix2custom(p[0], p[1])
+                       : map.point_pix2utm(p[0], p[1]);
+    return result;
+}
+
+void save_contours(const contours_t& lines, const gdal& map,
+        const std::string& filepath, const std::string& driver) {
+    GDALDriver *drv = GetGDALDriverManager()->GetDriverByName(
+        driver.c_str());
+    if (drv == NULL)
+        throw std::runtime_error("[contour] could not get the driver: " +
+            driver);
+    GDALDataset *dataset = drv->Create(filepath.c_str(), 0, 0, 0,
+        GDT_Unknown, NULL);
+    if (dataset == NULL)
+        throw std::runtime_error("[contour] could not create " + filepath);
+    OGRSpatialReference spatial_reference;
+    spatial_reference.SetUTM( map.get_utm_zone(), map.get_utm_north() );
+    spatial_reference.SetWellKnownGeogCS( "WGS84" );
+    OGRLayer *layer = dataset->CreateLayer("contour", &spatial_reference,
+        wkbLineString, NULL);
+    if (layer == NULL) {
+        GDALClose( (GDALDatasetH) dataset );
+        throw std::runtime_error("[contour] could not create the layer");
+    }
+    OGRFieldDefn field("LEVEL", OFTReal);
+    if (layer->CreateField(&field) != OGRERR_NONE) {
+        GDALClose( (GDALDatasetH) dataset );
+        throw std::runtime_error("[contour] could not create the field");
+    }
+    for (const auto& line : lines) {
+        OGRFeature *feature = OGRFeature::CreateFeature(
+            layer->GetLayerDefn());
+        feature->SetField("LEVEL", double(line.level));
+        OGRLineString geometry;
+        for (const auto& p : line.points)
+            geometry.addPoint(p[0], p[1]);
+        OGRErr error = feature->SetGeometry(&geometry);
+        if (error == OGRERR_NONE)
+            error = layer->CreateFeature(feature);
+        OGRFeature::DestroyFeature(feature);
+        if (error != OGRERR_NONE) {
+            GDALClose( (GDALDatasetH) dataset );
+            throw std::runtime_error("[contour] could not write a feature "
+                "in " + filepath);
+        }
+    }
+    GDALClose( (GDALDatasetH) dataset );
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,179 @@
+/*
+ * costdist.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gdalwrap/costdist.hpp"
+#include "gdalwrap/radix_heap.hpp"
+
+namespace gdalwrap {
+
+const std::string costdist_distance  = "DISTANCE";
+const std::string costdist_direction = "DIRECTION";
+
+static const int dx8[8] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+static const int dy8[8] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+enum { far = 0, trial = 1, frozen = 2 };
+
+/** solve (T - a)^2 / hx^2 + (T - b)^2 / hy^2 = f^2 with T >= max(a, b),
+ * a and b being the smallest neighbour along x and y (may be infinite)
+ */
+static double eikonal(double a, double b, double f, double hx, double hy) {
+    double t = std::min(a + f * hx, b + f * hy);
+    if (std::isinf(a) or std::isinf(b))
+        return t;
+    double wx = 1 / (hx * hx), wy = 1 / (hy * hy);
+    double qa = wx + wy, qb = -2 * (a * wx + b * wy),
+           qc = a * a * wx + b * b * wy - f * f;
+    double delta = qb * qb - 4 * qa * qc;
+    if (delta < 0)
+        return t;
+    double root = (-qb + std::sqrt(delta)) / (2 * qa);
+    return (root >= std::max(a, b)) ? std::min(t, root) : t;
+}
+
+gdal cost_distance(const gdal& map, size_t band, const points_xy_t& sources,
+        const points_xy_t& goals, bool custom) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const raster& cost = map.bands[band];
+    const long width = map.get_width(), height = map.get_height();
+    const double hx = std::abs(map.get_scale_x()),
+                 hy = std::abs(map.get_scale_y());
+    const size_t none = std::numeric_limits<size_t>::max();
+
+    gdal result;
+    result.copy_meta(map, 2);
+    result.names = { costdist_distance, costdist_direction };
+    raster& distance  = result.bands[0];
+    raster& direction = result.bands[1];
+    std::fill(distance.begin(), distance.end(), inf);
+    std::fill(direction.begin(), direction.end(), -1);
+    std::vector<double> t(width * height, inf); // double precision front
+    bytes_t state(width * height, far);
+
+    // goals: cells to reach before stopping early
+    bytes_t is_goal;
+    size_t n_goals = 0;
+    if (!goals.empty()) {
+        is_goal.assign(width * height, 0);
+        for (const auto& g : goals) {
+            size_t i = custom ? map.index_custom(g[0], g[1])
+                              : map.index_utm(g[0], g[1]);
+            if (i != none and !is_goal[i]) {
+                is_goal[i] = 1;
+                n_goals++;
+            }
+        }
+    }
+
+    double length[8];
+    for (int d = 0; d < 8; d++)
+        length[d] = std::hypot(dx8[d] * hx, dy8[d] * hy);
+
+    radix_heap<uint32_t> heap;
+    for (const auto& s : sources) {
+        size_t i = custom ? map.index_custom(s[0], s[1])
+                          : map.index_utm(s[0], s[1]);
+        if (i == none or !(cost[i] > 0))
+            continue;
+        t[i] = 0;
+        state[i] = trial;
+        heap.push(0, i);
+    }
+
+    while (!heap.empty()) {
+        float key = heap.top_key();
+        size_t i = heap.top();
+        heap.pop();
+        if (state[i] == frozen or key > float(t[i]))
+            continue; // outdated entry (lazy deletion)
+        state[i] = frozen;
+        if (n_goals > 0 and is_goal[i] and --n_goals == 0)
+            break;
+        // update the 4-neighbours
+        long x = i % width, y = i / width;
+        for (int d = 0; d < 8; d += 2) {
+            long nx = x + dx8[d], ny = y + dy8[d];
+            if (nx < 0 or ny < 0 or nx >= width or ny >= height)
+                continue;
+            size_t n = nx + ny * width;
+            if (state[n] == frozen or !(cost[n] > 0))
+                continue;
+            // smallest frozen neighbour along each axis
+            auto known = [&](size_t k) -> double {
+                return state[k] == frozen ? t[k] : inf;
+            };
+            double a = std::min(nx > 0 ? known(n - 1) : inf,
+                                nx < width - 1 ? known(n + 1) : inf);
+            double b = std::min(ny > 0 ? known(n - width) : inf,
+                                ny < height - 1 ? known(n + width) : inf);
+            double value = eikonal(a, b, cost[n], hx, hy);
+            if (value < t[n]) {
+                t[n] = value;
+                state[n] = trial;
+                heap.push(value, n);
+            }
+        }
+    }
+    // back-pointers: frozen neighbour of steepest descent, neighbours
+    // frozen later have a larger T so the result is the same as during
+    // the march, but this pass runs in parallel
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < height; y++) {
+        for (long x = 0; x < width; x++) {
+            size_t i = x + y * width;
+            if (state[i] != frozen)
+                continue;
+            distance[i] = t[i];
+            double best = 0;
+            for (int d = 0; d < 8; d++) {
+                long nx = x + dx8[d], ny = y + dy8[d];
+                if (nx < 0 or ny < 0 or nx >= width or ny >= height)
+                    continue;
+                size_t n = nx + ny * width;
+                if (state[n] != frozen)
+                    continue;
+                double slope = (t[i] - t[n]) / length[d];
+                if (slope > best) {
+                    best = slope;
+                    direction[i] = d;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+points_xy_t trace_back(const gdal& field, const point_xy_t& from,
+        bool custom) {
+    points_xy_t path;
+    const raster& direction = field.get_band(costdist_direction);
+    const raster& distance  = field.get_band(costdist_distance);
+    size_t width = field.get_width();
+    size_t i = custom ? field.index_custom(from[0], from[1])
+                      : field.index_utm(from[0], from[1]);
+    if (i == std::numeric_limits<size_t>::max() or std::isinf(distance[i]))
+        return path;
+    // the distance strictly decreases along the back-pointers
+    while (true) {
+        long x = i % width, y = i / width;
+        path.push_back(custom ? field.point_pix2custom(x, y)
+                              : field.point_pix2utm(x, y));
+        int d = direction[i];
+        if (d < 0)
+            break;
+        i = (x + dx8[d]) + (y + dy8[d]) * width;
+    }
+    return path;
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,124 @@
+/*
+ * dem.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "gdalwrap/dem.hpp"
+
+namespace gdalwrap {
+
+const std::string dem_n_points   = "N_POINTS";
+const std::string dem_z_min      = "Z_MIN";
+const std::string dem_z_max      = "Z_MAX";
+const std::string dem_z_mean     = "Z_MEAN";
+const std::string dem_z_variance = "Z_VARIANCE";
+
+void init_dem(gdal& map) {
+    const std::string names[] = { dem_n_points, dem_z_min, dem_z_max,
+                                  dem_z_mean, dem_z_variance };
+    size_t size = map.get_width() * map.get_height();
+    for (const auto& name : names) {
+        if (std::find(map.names.begin(), map.names.end(), name) ==
+                map.names.end()) {
+            map.bands.push_back(raster());
+            map.names.push_back(name);
+        }
+        map.get_band(name).assign(size, 0);
+    }
+}
+
+/** LSD radix sort of (cell, point) pairs by cell, 8 bits per pass
+ * only the passes needed for max_key are done
+ */
+static void radix_sort(std::vector<std::pair<uint64_t, uint32_t>>& pairs,
+        uint64_t max_key) {
+    std::vector<std::pair<uint64_t, uint32_t>> tmp(pairs.size());
+    for (size_t shift = 0; shift < 64 and (max_key >> shift) > 0;
+            shift += 8) {
+        size_t count[257] = {0};
+        for (const auto& p : pairs)
+            count[((p.first >> shift) & 0xff) + 1]++;
+        for (size_t i = 1; i < 257; i++)
+            count[i] += count[i - 1];
+        for (const auto& p : pairs)
+            tmp[count[(p.first >> shift) & 0xff]++] = p;
+        pairs.swap(tmp);
+    }
+}
+
+size_t add_points(gdal& map, const points_xyz_t& points, bool custom) {
+    raster& n_points = map.get_band(dem_n_points);
+    raster& z_min    = map.get_band(dem_z_min);
+    raster& z_max    = map.get_band(dem_z_max);
+    raster& z_mean   = map.get_band(dem_z_mean);
+    raster& z_var    = map.get_band(dem_z_variance);
+    const size_t none = std::numeric_limits<size_t>::max();
+
+    // 1. cell of each point
+    std::vector<size_t> cells(points.size());
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < long(points.size()); i++) {
+        const point_xyz_t& p = points[i];
+        cells[i] = custom ? map.index_custom(p[0], p[1])
+                          : map.index_utm(p[0], p[1]);
+    }
+    // 2. sort the points inside by cell
+    std::vector<std::pair<uint64_t, uint32_t>> pairs;
+    pairs.reserve(points.size());
+    for (size_t i = 0; i < points.size(); i++)
+        if (cells[i] != none)
+            pairs.push_back(std::make_pair(cells[i], i));
+    radix_sort(pairs, map.get_width() * map.get_height());
+    // 3. runs of the same cell
+    std::vector<size_t> runs;
+    for (size_t i = 0; i < pairs.size(); i++)
+        if (i == 0 or pairs[i].first != pairs[i - 1].first)
+            runs.push_back(i);
+    runs.push_back(pairs.size());
+    // 4. merge each run with the cell statistics, one cell per run (no race)
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (long r = 0; r < long(runs.size()) - 1; r++) {
+        size_t cell = pairs[runs[r]].first;
+        // Welford on the batch
+        double nb = 0, mb = 0, m2b = 0;
+        double lo = std::numeric_limits<double>::infinity(), hi = -lo;
+        for (size_t i = runs[r]; i < runs[r + 1]; i++) {
+            double z = points[pairs[i].second][2];
+            nb++;
+            double delta = z - mb;
+            mb += delta / nb;
+            m2b += delta * (z - mb);
+            lo = std::min(lo, z);
+            hi = std::max(hi, z);
+        }
+        // Chan et al. to merge with the current statistics
+        double na = n_points[cell];
+        if (na == 0) {
+            z_min[cell] = lo;
+            z_max[cell] = hi;
+            z_mean[cell] = mb;
+            z_var[cell] = m2b / nb;
+        } else {
+            double n = na + nb, ma = z_mean[cell];
+            double delta = mb - ma;
+            double m2 = z_var[cell] * na + m2b + delta * delta * na * nb / n;
+            z_min[cell] = std::min<double>(z_min[cell], lo);
+            z_max[cell] = std::max<double>(z_max[cell], hi);
+            z_mean[cell] = ma + delta * nb / n;
+            z_var[cell] = m2 / n;
+        }
+        n_points[cell] = na + nb;
+    }
+    return pairs.size();
+}
+
+} // namespace gdalwrap
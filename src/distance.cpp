@@ -0,0 +1,136 @@
+/*
+ * distance.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "gdalwrap/distance.hpp"
+
+namespace gdalwrap {
+
+static const double inf = std::numeric_limits<double>::infinity();
+
+/** 1D squared distance transform of f (n samples) with spacing w2 = scale^2
+ *
+ * d[p] = min_q w2 * (p - q)^2 + f[q], and arg[p] = argmin (if not NULL)
+ * v and z are working buffers of size n and n + 1.
+ */
+static void dt1d(const double *f, double *d, size_t n, double w2,
+        std::vector<size_t>& v, std::vector<double>& z, size_t *arg = NULL) {
+    long k = -1;
+    for (size_t q = 0; q < n; q++) {
+        if (f[q] == inf)
+            continue;
+        double fq = f[q] + w2 * q * q;
+        double s = -inf;
+        while (k >= 0) {
+            size_t r = v[k];
+            s = (fq - (f[r] + w2 * r * r)) / (2.0 * w2 * (q - r));
+            if (s > z[k])
+                break;
+            k--;
+        }
+        k++;
+        v[k] = q;
+        z[k] = (k == 0) ? -inf : s;
+        z[k + 1] = inf;
+    }
+    if (k < 0) { // no feature
+        std::fill(d, d + n, inf);
+        return;
+    }
+    long j = 0;
+    for (size_t p = 0; p < n; p++) {
+        while (z[j + 1] < p)
+            j++;
+        double dp = double(p) - double(v[j]);
+        d[p] = w2 * dp * dp + f[v[j]];
+        if (arg)
+            arg[p] = v[j];
+    }
+}
+
+bytes_t threshold(const raster& band, float threshold) {
+    bytes_t mask(band.size());
+    for (size_t i = 0; i < band.size(); i++)
+        mask[i] = band[i] >= threshold;
+    return mask;
+}
+
+/** nearest (feature transform) is optional, see dt1d
+ */
+static raster edt(const bytes_t& mask, size_t width, size_t height,
+        double scale_x, double scale_y, std::vector<size_t> *nearest) {
+    std::vector<double> sq(width * height);
+    std::vector<size_t> rows; // closest feature row, per cell
+    if (nearest) {
+        rows.resize(width * height);
+        nearest->assign(width * height, std::numeric_limits<size_t>::max());
+    }
+    double wx = scale_x * scale_x, wy = scale_y * scale_y;
+    long w = width, h = height;
+
+    // columns: gather in a contiguous buffer per thread
+    #pragma omp parallel
+    {
+        std::vector<double> f(h), d(h), z(h + 1);
+        std::vector<size_t> v(h), arg(nearest ? h : 0);
+        #pragma omp for schedule(static)
+        for (long x = 0; x < w; x++) {
+            for (long y = 0; y < h; y++)
+                f[y] = mask[x + y * w] ? 0.0 : inf;
+            dt1d(f.data(), d.data(), h, wy, v, z,
+                nearest ? arg.data() : NULL);
+            for (long y = 0; y < h; y++)
+                sq[x + y * w] = d[y];
+            if (nearest)
+                for (long y = 0; y < h; y++)
+                    rows[x + y * w] = arg[y];
+        }
+    }
+    raster result(width * height);
+    // rows: contiguous in memory
+    #pragma omp parallel
+    {
+        std::vector<double> d(w), z(w + 1);
+        std::vector<size_t> v(w), arg(nearest ? w : 0);
+        #pragma omp for schedule(static)
+        for (long y = 0; y < h; y++) {
+            double *row = sq.data() + y * w;
+            dt1d(row, d.data(), w, wx, v, z, nearest ? arg.data() : NULL);
+            for (long x = 0; x < w; x++)
+                result[x + y * w] = std::sqrt(d[x]);
+            if (nearest)
+                for (long x = 0; x < w; x++)
+                    if (d[x] != inf)
+                        (*nearest)[x + y * w] = arg[x] +
+                            rows[arg[x] + y * w] * w;
+        }
+    }
+    return result;
+}
+
+raster distance_transform(const bytes_t& mask, size_t width, size_t height,
+        double scale_x, double scale_y) {
+    return edt(mask, width, height, scale_x, scale_y, NULL);
+}
+
+raster distance_transform(const bytes_t& mask, size_t width, size_t height,
+        std::vector<size_t>& nearest, double scale_x, double scale_y) {
+    return edt(mask, width, height, scale_x, scale_y, &nearest);
+}
+
+raster distance_transform(const gdal& map, size_t band, float threshold) {
+    return distance_transform(gdalwrap::threshold(map.bands[band], threshold),
+        map.get_width(), map.get_height(),
+        std::abs(map.get_scale_x()), std::abs(map.get_scale_y()));
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,194 @@
+/*
+ * fill.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "gdalwrap/fill.hpp"
+#include "gdalwrap/distance.hpp"
+
+namespace gdalwrap {
+
+static bytes_t valid_mask(const raster& band, float no_data) {
+    bytes_t valid(band.size());
+    bool nan = std::isnan(no_data);
+    for (size_t i = 0; i < band.size(); i++)
+        valid[i] = nan ? !std::isnan(band[i]) : band[i] != no_data;
+    return valid;
+}
+
+size_t fill_nearest(raster& band, size_t width, size_t height, float no_data,
+        double max_distance) {
+    bytes_t valid = valid_mask(band, no_data);
+    std::vector<size_t> nearest;
+    raster distance = distance_transform(valid, width, height, nearest);
+    size_t count = 0;
+    #pragma omp parallel for reduction(+:count)
+    for (long i = 0; i < long(band.size()); i++) {
+        if (valid[i] or !(distance[i] <= max_distance))
+            continue;
+        band[i] = band[nearest[i]];
+        count++;
+    }
+    return count;
+}
+
+size_t fill_idw(raster& band, size_t width, size_t height, float no_data,
+        double max_distance, double power) {
+    bytes_t valid = valid_mask(band, no_data);
+    raster result(band);
+    long w = width, h = height;
+    // no farther than the raster (and no cast of infinity to long)
+    double limit = std::max(w, h);
+    long r = max_distance < limit ? std::floor(max_distance) : limit;
+    // weights of the window offsets, 0 outside the radius
+    std::vector<double> weights((2 * r + 1) * (2 * r + 1), 0);
+    for (long dy = -r; dy <= r; dy++)
+        for (long dx = -r; dx <= r; dx++) {
+            double d = std::hypot(dx, dy);
+            if (d > 0 and d <= max_distance)
+                weights[(dx + r) + (dy + r) * (2 * r + 1)] =
+                    1 / std::pow(d, power);
+        }
+    size_t count = 0;
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:count)
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            if (valid[x + y * w])
+                continue;
+            double sum = 0, total = 0;
+            for (long dy = std::max(-r, -y); dy <= std::min(r, h - 1 - y);
+                    dy++) {
+                const double *wrow = weights.data() + (dy + r) * (2 * r + 1);
+                size_t row = (y + dy) * w;
+                for (long dx = std::max(-r, -x); dx <= std::min(r, w - 1 - x);
+                        dx++) {
+                    size_t i = x + dx + row;
+                    if (valid[i]) {
+                        double wi = wrow[dx + r];
+                        sum += wi * band[i];
+                        total += wi;
+                    }
+                }
+            }
+            if (total > 0) {
+                result[x + y * w] = sum / total;
+                count++;
+            }
+        }
+    }
+    band.swap(result);
+    return count;
+}
+
+/** solve the holes of v (valid[i] == 0) on this level
+ */
+static void laplace_level(raster& v, const bytes_t& valid,
+        size_t width, size_t height, size_t sweeps) {
+    size_t size = width * height;
+    size_t holes = std::count(valid.begin(), valid.end(), 0);
+    if (holes == 0)
+        return;
+    if (holes == size) // nothing to interpolate from
+        return;
+    if (width > 2 or height > 2) {
+        // coarse level: mean of the valid children
+        size_t cw = (width + 1) / 2, ch = (height + 1) / 2;
+        raster cv(cw * ch, 0);
+        bytes_t cvalid(cw * ch, 0);
+        std::vector<float> count(cw * ch, 0);
+        for (size_t y = 0; y < height; y++)
+            for (size_t x = 0; x < width; x++)
+                if (valid[x + y * width]) {
+                    size_t c = x / 2 + (y / 2) * cw;
+                    cv[c] += v[x + y * width];
+                    count[c]++;
+                }
+        for (size_t c = 0; c < cw * ch; c++)
+            if (count[c] > 0) {
+                cv[c] /= count[c];
+                cvalid[c] = 1;
+            }
+        laplace_level(cv, cvalid, cw, ch, sweeps);
+        // initial guess of the holes from the coarse solution
+        for (size_t y = 0; y < height; y++)
+            for (size_t x = 0; x < width; x++)
+                if (!valid[x + y * width])
+                    v[x + y * width] = cv[x / 2 + (y / 2) * cw];
+    } else {
+        float mean = 0, n = 0;
+        for (size_t i = 0; i < size; i++)
+            if (valid[i]) {
+                mean += v[i];
+                n++;
+            }
+        for (size_t i = 0; i < size; i++)
+            if (!valid[i])
+                v[i] = mean / n;
+    }
+    // red-black Gauss-Seidel on the holes
+    long w = width, h = height;
+    for (size_t it = 0; it < sweeps; it++) {
+        for (long color = 0; color < 2; color++) {
+            #pragma omp parallel for schedule(static)
+            for (long y = 0; y < h; y++) {
+                for (long x = (y + color) % 2; x < w; x += 2) {
+                    size_t i = x + y * w;
+                    if (valid[i])
+                        continue;
+                    float sum = 0, n = 0;
+                    if (x > 0)     { sum += v[i - 1]; n++; }
+                    if (x < w - 1) { sum += v[i + 1]; n++; }
+                    if (y > 0)     { sum += v[i - w]; n++; }
+                    if (y < h - 1) { sum += v[i + w]; n++; }
+                    v[i] = sum / n;
+                }
+            }
+        }
+    }
+}
+
+size_t fill_laplace(raster& band, size_t width, size_t height, float no_data,
+        double max_distance, size_t sweeps) {
+    bytes_t valid = valid_mask(band, no_data);
+    if (std::find(valid.begin(), valid.end(), 1) == valid.end())
+        return 0;
+    raster v(band);
+    laplace_level(v, valid, width, height, sweeps);
+    raster distance = distance_transform(valid, width, height);
+    size_t count = 0;
+    for (size_t i = 0; i < band.size(); i++) {
+        if (valid[i] or !(distance[i] <= max_distance))
+            continue;
+        band[i] = v[i];
+        count++;
+    }
+    return count;
+}
+
+size_t fill(gdal& map, size_t band, float no_data, double max_distance,
+        fill_method method) {
+    // distances in pixels, of the finer axis if the cells are not square
+    double pixels = max_distance / std::min(std::abs(map.get_scale_x()),
+                                            std::abs(map.get_scale_y()));
+    raster& data = map.bands[band];
+    size_t width = map.get_width(), height = map.get_height();
+    switch (method) {
+    case fill_method::nearest:
+        return fill_nearest(data, width, height, no_data, pixels);
+    case fill_method::idw:
+        return fill_idw(data, width, height, no_data, pixels);
+    default:
+        return fill_laplace(data, width, height, no_data, pixels);
+    }
+}
+
+} // namespace gdalwrap
@@ -40,12 +40,45 @@ void gdal::_init() {
     set_utm(0);
 }
 
+/** Set projection, geotransform, metadata, and write the bands
+ *
+ * @param dataset with bands.size() Float32 bands of width x height.
+ */
+void gdal::write(GDALDataset *dataset) const {
+    set_wgs84(dataset, utm_zone, utm_north);
+    // see GDALDataset::GetGeoTransform()
+    dataset->SetGeoTransform( (double *) transform.data() );
+    // Set dataset metadata
+    for (const auto& pair : metadata)
+        dataset->SetMetadataItem( pair.first.c_str(), pair.second.c_str() );
+
+    GDALRasterBand *band;
+    for (size_t band_id = 0; band_id < bands.size(); band_id++) {
+        band = dataset->GetRasterBand(band_id+1);
+        band->RasterIO( GF_Write, 0, 0, width, height,
+            (void *) bands[band_id].data(), width, height, GDT_Float32, 0, 0 );
+        band->SetMetadataItem("NAME", names[band_id].c_str());
+    }
+}
+
 /** Save as GeoTiff
  *
  * @param filepath path to .tif file.
  * @param compress fastest deflate (zlib/png).
  */
 void gdal::save(const std::string& filepath, bool compress) const {
+    save(filepath, std::vector<int>(), "", compress);
+}
+
+/** Save as GeoTiff with internal overviews
+ *
+ * @param filepath path to .tif file.
+ * @param overviews reduction factors, e.g. {2, 4, 8}.
+ * @param resampling GDAL overview resampling, e.g. "AVERAGE".
+ * @param compress fastest deflate (zlib/png).
+ */
+void gdal::save(const std::string& filepath, const std::vector<int>& overviews,
+                const std::string& resampling, bool compress) const {
     // get the GDAL GeoTIFF driver
     GDALDriver *driver = GetGDALDriverManager()->GetDriverByName("GTiff");
     if ( driver == NULL )
@@ -64,19 +97,15 @@ void gdal::save(const std::string& filepath, bool compress) const {
     if ( dataset == NULL )
         throw std::runtime_error("[gdal] could not create (multi-layers float32)");
 
-    set_wgs84(dataset, utm_zone, utm_north);
-    // see GDALDataset::GetGeoTransform()
-    dataset->SetGeoTransform( (double *) transform.data() );
-    // Set dataset metadata
-    for (const auto& pair : metadata)
-        dataset->SetMetadataItem( pair.first.c_str(), pair.second.c_str() );
+    write(dataset);
 
-    GDALRasterBand *band;
-    for (size_t band_id = 0; band_id < bands.size(); band_id++) {
-        band = dataset->GetRasterBand(band_id+1);
-        band->RasterIO( GF_Write, 0, 0, width, height,
-            (void *) bands[band_id].data(), width, height, GDT_Float32, 0, 0 );
-        band->SetMetadataItem("NAME", names[band_id].c_str());
+    if ( !overviews.empty() ) {
+        // stored inside the GeoTiff since the dataset is opened for writing
+        std::vector<int> factors(overviews);
+        if ( dataset->BuildOverviews( resampling.c_str(), factors.size(),
+                factors.data(), 0, NULL, NULL, NULL ) != CE_None )
+            std::cerr<<"[warn]["<< __func__ <<"] could not build overviews"
+                     <<std::endl;
     }
 
     // close properly the dataset
@@ -84,6 +113,76 @@ void gdal::save(const std::string& filepath, bool compress) const {
     CSLDestroy( options );
 }
 
+/** Save as Cloud Optimized GeoTiff
+ *
+ * Write the bands in memory, build the overviews there, and then copy the
+ * dataset with the COG driver (or GTiff + COPY_SRC_OVERVIEWS), which puts
+ * all the IFDs first, then the overviews, then the full resolution tiles.
+ *
+ * @param filepath path to .tif file.
+ * @param resampling GDAL overview resampling, e.g. "AVERAGE".
+ * @param compress fastest deflate (zlib/png).
+ * @param blocksize tile size in pixels (default 256).
+ */
+void gdal::save_cog(const std::string& filepath, const std::string& resampling,
+                    bool compress, int blocksize) const {
+    GDALDriver *drmem = GetGDALDriverManager()->GetDriverByName("MEM");
+    if ( drmem == NULL )
+        throw std::runtime_error("[gdal] could not get the MEM driver");
+    GDALDriver *driver = NULL;
+#if GDAL_VERSION_NUM >= 3010000
+    driver = GetGDALDriverManager()->GetDriverByName("COG");
+#endif
+    bool cog = (driver != NULL);
+    if ( !cog )
+        driver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if ( driver == NULL )
+        throw std::runtime_error("[gdal] could not get the driver");
+
+    GDALDataset *dataset = drmem->Create( "", width, height,
+        bands.size(), GDT_Float32, NULL );
+    if ( dataset == NULL )
+        throw std::runtime_error("[gdal] could not create (multi-layers float32)");
+    write(dataset);
+
+    // overviews until the whole raster fits in one tile
+    std::vector<int> factors;
+    for (size_t factor = 2; width > factor / 2 * blocksize or
+                            height > factor / 2 * blocksize; factor *= 2)
+        factors.push_back(factor);
+    if ( !factors.empty() and dataset->BuildOverviews( resampling.c_str(),
+            factors.size(), factors.data(), 0, NULL, NULL, NULL ) != CE_None )
+        std::cerr<<"[warn]["<< __func__ <<"] could not build overviews"
+                 <<std::endl;
+
+    std::string bsize = std::to_string(blocksize);
+    char ** options = NULL;
+    if (compress) {
+        // fastest deflate (zlib/png)
+        options = CSLSetNameValue( options, "COMPRESS",     "DEFLATE" );
+        options = CSLSetNameValue( options, "PREDICTOR",    cog ? "YES" : "3" );
+        options = CSLSetNameValue( options, cog ? "LEVEL" : "ZLEVEL", "1" );
+    }
+    if (cog) {
+        options = CSLSetNameValue( options, "BLOCKSIZE",    bsize.c_str() );
+        options = CSLSetNameValue( options, "OVERVIEWS",
+            "FORCE_USE_EXISTING" );
+    } else {
+        options = CSLSetNameValue( options, "TILED",        "YES" );
+        options = CSLSetNameValue( options, "BLOCKXSIZE",   bsize.c_str() );
+        options = CSLSetNameValue( options, "BLOCKYSIZE",   bsize.c_str() );
+        options = CSLSetNameValue( options, "COPY_SRC_OVERVIEWS", "YES" );
+    }
+    GDALDataset *copy = driver->CreateCopy( filepath.c_str(), dataset, 0,
+        options, NULL, NULL );
+    CSLDestroy( options );
+    GDALClose( (GDALDatasetH) dataset );
+    if ( copy == NULL )
+        throw std::runtime_error("[gdal] could not create COG");
+    // close properly the dataset
+    GDALClose( (GDALDatasetH) copy );
+}
+
 /** Load a GeoTiff
  *
  * @param filepath path to .tif file.
@@ -0,0 +1,161 @@
+/*
+ * geographic.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>        // for runtime_error
+#include <gdal_priv.h>      // for GDAL_VERSION_MAJOR
+#include <ogr_spatialref.h> // for OGRSpatialReference
+
+#include "gdalwrap/geographic.hpp"
+
+namespace gdalwrap {
+
+// OGR Transform takes separate x / y arrays, convert by chunks
+static const size_t chunk = 4096;
+
+wgs84::wgs84(const gdal& map) : grid_step(0), grid_width(0), grid_height(0) {
+    meta.copy_meta_only(map);
+    meta.set_size(map.get_width(), map.get_height());
+    OGRSpatialReference utm, geo;
+    utm.SetUTM( map.get_utm_zone(), map.get_utm_north() );
+    utm.SetWellKnownGeogCS( "WGS84" );
+    geo.SetWellKnownGeogCS( "WGS84" );
+#if GDAL_VERSION_MAJOR >= 3
+    // lon, lat order (GDAL 3 follows the authority: lat, lon)
+    utm.SetAxisMappingStrategy( OAMS_TRADITIONAL_GIS_ORDER );
+    geo.SetAxisMappingStrategy( OAMS_TRADITIONAL_GIS_ORDER );
+#endif
+    utm2geo = OGRCreateCoordinateTransformation( &utm, &geo );
+    geo2utm = OGRCreateCoordinateTransformation( &geo, &utm );
+    if ( utm2geo == NULL or geo2utm == NULL ) {
+        OGRCoordinateTransformation::DestroyCT( utm2geo );
+        OGRCoordinateTransformation::DestroyCT( geo2utm );
+        throw std::runtime_error("[gdal] could not create transformation");
+    }
+}
+
+wgs84::~wgs84() {
+    OGRCoordinateTransformation::DestroyCT( utm2geo );
+    OGRCoordinateTransformation::DestroyCT( geo2utm );
+}
+
+void wgs84::transform(OGRCoordinateTransformation *ct,
+        points_xy_t& points) const {
+    std::vector<double> xs(chunk), ys(chunk);
+    for (size_t start = 0; start < points.size(); start += chunk) {
+        size_t n = std::min(chunk, points.size() - start);
+        for (size_t i = 0; i < n; i++) {
+            xs[i] = points[start + i][0];
+            ys[i] = points[start + i][1];
+        }
+        if ( !ct->Transform( n, xs.data(), ys.data() ) )
+            throw std::runtime_error("[gdal] could not transform points");
+        for (size_t i = 0; i < n; i++) {
+            points[start + i][0] = xs[i];
+            points[start + i][1] = ys[i];
+        }
+    }
+}
+
+void wgs84::approximate(size_t step) {
+    grid_step = step;
+    grid.clear();
+    if (step == 0)
+        return;
+    // one more node past the last pixel so that the grid covers the raster
+    grid_width  = meta.get_width()  / step + 2;
+    grid_height = meta.get_height() / step + 2;
+    grid.resize(grid_width * grid_height);
+    for (size_t y = 0; y < grid_height; y++)
+        for (size_t x = 0; x < grid_width; x++)
+            grid[x + y * grid_width] = meta.point_pix2utm(x * double(step),
+                                                          y * double(step));
+    transform(utm2geo, grid);
+}
+
+/** bilinear interpolation in the grid for pixels inside the raster,
+ * exact transformation for the others
+ */
+void wgs84::pix2lonlat_approx(points_xy_t& points) const {
+    double w = meta.get_width(), h = meta.get_height();
+    std::vector<size_t> outside;
+    for (size_t i = 0; i < points.size(); i++) {
+        double x = points[i][0], y = points[i][1];
+        if ( !(x >= 0 and y >= 0 and x <= w and y <= h) )
+            outside.push_back(i);
+    }
+    // exact transformation for the pixels outside the grid
+    points_xy_t rest(outside.size());
+    for (size_t i = 0; i < outside.size(); i++)
+        rest[i] = meta.point_pix2utm(points[outside[i]][0],
+                                     points[outside[i]][1]);
+    transform(utm2geo, rest);
+
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < long(points.size()); i++) {
+        double x = points[i][0], y = points[i][1];
+        if ( !(x >= 0 and y >= 0 and x <= w and y <= h) )
+            continue;
+        double gx = x / grid_step, gy = y / grid_step;
+        size_t x0 = std::min(size_t(gx), grid_width  - 2),
+               y0 = std::min(size_t(gy), grid_height - 2);
+        double fx = gx - x0, fy = gy - y0;
+        const point_xy_t& p00 = grid[x0 + y0 * grid_width];
+        const point_xy_t& p10 = grid[x0 + 1 + y0 * grid_width];
+        const point_xy_t& p01 = grid[x0 + (y0 + 1) * grid_width];
+        const point_xy_t& p11 = grid[x0 + 1 + (y0 + 1) * grid_width];
+        for (size_t k = 0; k < 2; k++)
+            points[i][k] = (p00[k] * (1 - fx) + p10[k] * fx) * (1 - fy)
+                         + (p01[k] * (1 - fx) + p11[k] * fx) * fy;
+    }
+    for (size_t i = 0; i < outside.size(); i++)
+        points[outside[i]] = rest[i];
+}
+
+void wgs84::utm2lonlat(points_xy_t& points) const {
+    if (grid.empty())
+        return transform(utm2geo, points);
+    for (auto& p : points)
+        p = meta.point_utm2pix(p[0], p[1]);
+    pix2lonlat_approx(points);
+}
+
+void wgs84::lonlat2utm(points_xy_t& points) const {
+    transform(geo2utm, points);
+}
+
+void wgs84::pix2lonlat(points_xy_t& points) const {
+    if ( !grid.empty() )
+        return pix2lonlat_approx(points);
+    for (auto& p : points)
+        p = meta.point_pix2utm(p[0], p[1]);
+    transform(utm2geo, points);
+}
+
+void wgs84::lonlat2pix(points_xy_t& points) const {
+    transform(geo2utm, points);
+    for (auto& p : points)
+        p = meta.point_utm2pix(p[0], p[1]);
+}
+
+void wgs84::custom2lonlat(points_xy_t& points) const {
+    for (auto& p : points)
+        p = meta.point_custom2utm(p[0], p[1]);
+    utm2lonlat(points);
+}
+
+void wgs84::lonlat2custom(points_xy_t& points) const {
+    transform(geo2utm, points);
+    for (auto& p : points)
+        p = meta.point_utm2custom(p[0], p[1]);
+}
+
+} // namespace gdalwrap
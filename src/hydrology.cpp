@@ -0,0 +1,332 @@
+/*
+ * hydrology.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <queue>
+#include <cstdint>
+#include <cstring>      // std::memcpy
+#include <functional>   // std::greater
+#include <stdexcept>    // std::invalid_argument
+#include "gdalwrap/hydrology.hpp"
+
+namespace gdalwrap {
+
+const std::string flow_filled       = "FILLED";
+const std::string flow_direction    = "DIRECTION";
+const std::string flow_accumulation = "ACCUMULATION";
+
+static const int dx8[8] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+static const int dy8[8] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+/** unsigned key with the order of the float (negative values included) */
+static uint32_t ordered(float z) {
+    uint32_t u;
+    std::memcpy(&u, &z, sizeof(u));
+    return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+}
+
+size_t fill_pits(raster& dem, size_t width, size_t height, bool epsilon,
+        float no_data) {
+    if (uint64_t(width) * height > (uint64_t(1) << 32))
+        throw std::invalid_argument("[hydrology] fill_pits: more than 2^32 "
+            "cells, indices are 32 bits");
+    const long w = width, h = height;
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    // priority queue of (elevation, index) packed in 64 bits
+    std::priority_queue<uint64_t, std::vector<uint64_t>,
+        std::greater<uint64_t>> open;
+    std::queue<uint32_t> pit;
+    std::vector<bool> closed(width * height, false);
+    auto push = [&](size_t i) {
+        closed[i] = true;
+        open.push(uint64_t(ordered(dem[i])) << 32 | i);
+    };
+    // seeds: the border and the neighbours of no-data
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            size_t i = x + y * w;
+            if (!valid(dem[i])) {
+                closed[i] = true;
+                continue;
+            }
+            bool seed = (x == 0 or y == 0 or x == w - 1 or y == h - 1);
+            for (int d = 0; d < 8 and !seed; d++)
+                seed = !valid(dem[(x + dx8[d]) + (y + dy8[d]) * w]);
+            if (seed)
+                push(i);
+        }
+    }
+    size_t raised = 0;
+    while (!open.empty() or !pit.empty()) {
+        size_t i;
+        if (!pit.empty()) {
+            i = pit.front();
+            pit.pop();
+        } else {
+            i = open.top() & 0xffffffffu;
+            open.pop();
+        }
+        float spill = epsilon ? std::nextafter(dem[i],
+            std::numeric_limits<float>::infinity()) : dem[i];
+        long x = i % w, y = i / w;
+        for (int d = 0; d < 8; d++) {
+            long nx = x + dx8[d], ny = y + dy8[d];
+            if (nx < 0 or ny < 0 or nx >= w or ny >= h)
+                continue;
+            size_t n = nx + ny * w;
+            if (closed[n])
+                continue;
+            closed[n] = true;
+            if (dem[n] <= spill) {
+                if (dem[n] < spill)
+                    raised++;
+                dem[n] = spill;
+                pit.push(n);
+            } else {
+                open.push(uint64_t(ordered(dem[n])) << 32 | n);
+            }
+        }
+    }
+    return raised;
+}
+
+raster flow_direction_d8(const raster& dem, size_t width, size_t height,
+        double scale_x, double scale_y, float no_data) {
+    const long w = width, h = height;
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    double length[8];
+    for (int d = 0; d < 8; d++)
+        length[d] = std::hypot(dx8[d] * scale_x, dy8[d] * scale_y);
+    raster direction(width * height, -1);
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            size_t i = x + y * w;
+            if (!valid(dem[i]))
+                continue;
+            double best = 0;
+            for (int d = 0; d < 8; d++) {
+                long nx = x + dx8[d], ny = y + dy8[d];
+                if (nx < 0 or ny < 0 or nx >= w or ny >= h)
+                    continue;
+                float z = dem[nx + ny * w];
+                if (!valid(z))
+                    continue;
+                double slope = (dem[i] - z) / length[d];
+                if (slope > best) {
+                    best = slope;
+                    direction[i] = d;
+                }
+            }
+        }
+    }
+    return direction;
+}
+
+/** angle of each D8 direction in the metric frame (y down), increasing */
+static void direction_angles(double sx, double sy, double theta[9]) {
+    for (int d = 0; d < 8; d++) {
+        theta[d] = std::atan2(dy8[d] * sy, dx8[d] * sx);
+        if (theta[d] < 0)
+            theta[d] += 2 * M_PI;
+    }
+    theta[8] = 2 * M_PI;
+}
+
+raster flow_direction_dinf(const raster& dem, size_t width, size_t height,
+        double scale_x, double scale_y, float no_data) {
+    const long w = width, h = height;
+    const double sx = std::abs(scale_x), sy = std::abs(scale_y);
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    double theta[9];
+    direction_angles(sx, sy, theta);
+    const double rmax_x = std::atan2(sy, sx), rmax_y = std::atan2(sx, sy);
+    const double diagonal = std::hypot(sx, sy);
+    raster angle(width * height, -1);
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            size_t i = x + y * w;
+            float e0 = dem[i];
+            if (!valid(e0))
+                continue;
+            double best = 0;
+            // facet k between the directions k and k + 1
+            for (int k = 0; k < 8; k++) {
+                int c = (k % 2 == 0) ? k : (k + 1) % 8; // cardinal
+                int g = (k % 2 == 0) ? k + 1 : k;       // diagonal
+                long cx = x + dx8[c], cy = y + dy8[c];
+                long gx = x + dx8[g], gy = y + dy8[g];
+                if (cx < 0 or cy < 0 or cx >= w or cy >= h or
+                    gx < 0 or gy < 0 or gx >= w or gy >= h)
+                    continue;
+                float e1 = dem[cx + cy * w], e2 = dem[gx + gy * w];
+                if (!valid(e1) or !valid(e2))
+                    continue;
+                // d1 along the cardinal, d2 from the cardinal to diagonal
+                bool along_x = dx8[c] != 0;
+                double d1 = along_x ? sx : sy, d2 = along_x ? sy : sx;
+                double s1 = (e0 - e1) / d1, s2 = (e1 - e2) / d2;
+                // steepest slope of the facet, its angle only if better
+                double slope, r;
+                if (s2 <= 0) { // towards the cardinal
+                    slope = s1;
+                    if (slope <= best)
+                        continue;
+                    r = 0;
+                } else if (s1 <= 0 or s2 * d1 >= s1 * d2) {
+                    slope = (e0 - e2) / diagonal; // towards the diagonal
+                    if (slope <= best)
+                        continue;
+                    r = along_x ? rmax_x : rmax_y;
+                } else {
+                    slope = std::sqrt(s1 * s1 + s2 * s2);
+                    if (slope <= best)
+                        continue;
+                    r = std::atan2(s2, s1);
+                }
+                best = slope;
+                double a = (k % 2 == 0) ? theta[c] + r : theta[k + 1] - r;
+                angle[i] = (a >= 2 * M_PI) ? a - 2 * M_PI : a;
+            }
+        }
+    }
+    return angle;
+}
+
+/** accumulate along receivers in topological order (Kahn)
+ *
+ * receivers(i, r, f) gives up to 2 receivers r[] and fractions f[],
+ * returns their number.
+ */
+template <class Receivers>
+static raster accumulate(size_t size, const raster* weight,
+        Receivers receivers) {
+    raster acc(size);
+    std::vector<uint8_t> donors(size, 0);
+    for (size_t i = 0; i < size; i++) {
+        acc[i] = weight ? (*weight)[i] : 1;
+        size_t r[2];
+        float f[2];
+        int n = receivers(i, r, f);
+        for (int k = 0; k < n; k++)
+            donors[r[k]]++;
+    }
+    std::vector<size_t> stack;
+    for (size_t i = 0; i < size; i++)
+        if (donors[i] == 0)
+            stack.push_back(i);
+    while (!stack.empty()) {
+        size_t i = stack.back();
+        stack.pop_back();
+        size_t r[2];
+        float f[2];
+        int n = receivers(i, r, f);
+        for (int k = 0; k < n; k++) {
+            acc[r[k]] += f[k] * acc[i];
+            if (--donors[r[k]] == 0)
+                stack.push_back(r[k]);
+        }
+    }
+    return acc;
+}
+
+raster flow_accumulation_d8(const raster& direction, size_t width,
+        size_t height, const raster* weight) {
+    const long w = width, h = height;
+    return accumulate(width * height, weight,
+        [&](size_t i, size_t* r, float* f) -> int {
+            int d = direction[i];
+            if (d < 0 or d > 7)
+                return 0;
+            long nx = i % w + dx8[d], ny = i / w + dy8[d];
+            if (nx < 0 or ny < 0 or nx >= w or ny >= h)
+                return 0;
+            r[0] = nx + ny * w;
+            f[0] = 1;
+            return 1;
+        });
+}
+
+raster flow_accumulation_dinf(const raster& angle, size_t width,
+        size_t height, double scale_x, double scale_y,
+        const raster* weight) {
+    const long w = width, h = height;
+    double theta[9];
+    direction_angles(std::abs(scale_x), std::abs(scale_y), theta);
+    return accumulate(width * height, weight,
+        [&](size_t i, size_t* r, float* f) -> int {
+            float a = angle[i];
+            if (!(a >= 0))
+                return 0;
+            int d = 0;
+            while (d < 7 and a >= theta[d + 1])
+                d++;
+            float part = (theta[d + 1] - a) / (theta[d + 1] - theta[d]);
+            // on a facet edge all the flow goes to one neighbour
+            if (part < 1e-6)
+                part = 0;
+            else if (part > 1 - 1e-6)
+                part = 1;
+            int n = 0;
+            for (int k = 0; k < 2; k++) {
+                int e = (d + k) % 8;
+                float fraction = k ? 1 - part : part;
+                long nx = i % w + dx8[e], ny = i / w + dy8[e];
+                if (fraction <= 0 or nx < 0 or ny < 0 or nx >= w or
+                    ny >= h)
+                    continue;
+                r[n] = nx + ny * w;
+                f[n] = fraction;
+                n++;
+            }
+            return n;
+        });
+}
+
+gdal flow(const gdal& map, size_t band, bool dinf, float no_data) {
+    const size_t width = map.get_width(), height = map.get_height();
+    const double sx = std::abs(map.get_scale_x()),
+                 sy = std::abs(map.get_scale_y());
+    gdal result;
+    result.copy_meta(map, 3);
+    result.names = { flow_filled, flow_direction, flow_accumulation };
+    result.bands[0] = map.bands[band];
+    fill_pits(result.bands[0], width, height, true, no_data);
+    if (dinf) {
+        result.bands[1] = flow_direction_dinf(result.bands[0], width,
+            height, sx, sy, no_data);
+        result.bands[2] = flow_accumulation_dinf(result.bands[1], width,
+            height, sx, sy);
+    } else {
+        result.bands[1] = flow_direction_d8(result.bands[0], width, height,
+            sx, sy, no_data);
+        result.bands[2] = flow_accumulation_d8(result.bands[1], width,
+            height);
+    }
+    // no flow on no-data cells
+    const raster& filled = result.bands[0];
+    raster& accumulation = result.bands[2];
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < long(filled.size()); i++)
+        if (std::isnan(filled[i]) or filled[i] == no_data)
+            accumulation[i] = no_data;
+    return result;
+}
+
+} // namespace gdalwrap
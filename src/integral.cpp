@@ -0,0 +1,179 @@
+/*
+ * integral.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "gdalwrap/integral.hpp"
+
+namespace gdalwrap {
+
+void integral::build(const raster& band, size_t width, size_t height) {
+    this->width = width;
+    this->height = height;
+    size_t stride = width + 1;
+    sum1.assign(stride * (height + 1), 0.0);
+    sum2.assign(stride * (height + 1), 0.0);
+    offset = 0;
+    for (float v : band)
+        offset += v;
+    if (!band.empty())
+        offset /= band.size();
+    // prefix sum of each row, in parallel
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < long(height); y++) {
+        const float *src = band.data() + y * width;
+        double *s1 = sum1.data() + (y + 1) * stride;
+        double *s2 = sum2.data() + (y + 1) * stride;
+        double acc1 = 0, acc2 = 0;
+        for (size_t x = 0; x < width; x++) {
+            double d = src[x] - offset;
+            acc1 += d;
+            acc2 += d * d;
+            s1[x + 1] = acc1;
+            s2[x + 1] = acc2;
+        }
+    }
+    // accumulate rows, contiguous inner loop (SIMD)
+    for (size_t y = 2; y <= height; y++) {
+        double *s1 = sum1.data() + y * stride;
+        double *s2 = sum2.data() + y * stride;
+        const double *p1 = s1 - stride;
+        const double *p2 = s2 - stride;
+        for (size_t x = 0; x < stride; x++) {
+            s1[x] += p1[x];
+            s2[x] += p2[x];
+        }
+    }
+}
+
+void integral::update(const raster& band, long x0, long y0, long x1,
+        long y1) {
+    if (!clip(x0, y0, x1, y1))
+        return;
+    // S[Y][X] = S[Y-1][X] + S[Y][X-1] - S[Y-1][X-1] + v(X-1, Y-1), the
+    // entries before (x0 + 1, y0 + 1) do not depend on the window
+    size_t stride = width + 1;
+    for (size_t y = y0 + 1; y <= height; y++) {
+        const float *src = band.data() + (y - 1) * width;
+        for (size_t x = x0 + 1; x <= width; x++) {
+            double d = src[x - 1] - offset;
+            size_t i = x + y * stride;
+            sum1[i] = sum1[i - stride] + sum1[i - 1] - sum1[i - stride - 1]
+                    + d;
+            sum2[i] = sum2[i - stride] + sum2[i - 1] - sum2[i - stride - 1]
+                    + d * d;
+        }
+    }
+}
+
+void integral::build(const gdal& map, size_t band) {
+    meta.copy_meta_only(map);
+    build(map.bands[band], map.get_width(), map.get_height());
+}
+
+bool integral::clip(long& x0, long& y0, long& x1, long& y1) const {
+    if (x1 < x0) std::swap(x0, x1);
+    if (y1 < y0) std::swap(y0, y1);
+    x0 = std::max(x0, 0L);
+    y0 = std::max(y0, 0L);
+    x1 = std::min(x1, long(width)  - 1);
+    y1 = std::min(y1, long(height) - 1);
+    return x0 <= x1 and y0 <= y1;
+}
+
+size_t integral::count(long x0, long y0, long x1, long y1) const {
+    if (!clip(x0, y0, x1, y1))
+        return 0;
+    return (x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+// window sums of the centered values (v - offset), clipped
+static inline double window_sum(const std::vector<double>& s, size_t stride,
+        long x0, long y0, long x1, long y1) {
+    return s[(x1 + 1) + (y1 + 1) * stride] - s[x0 + (y1 + 1) * stride]
+         - s[(x1 + 1) + y0 * stride]       + s[x0 + y0 * stride];
+}
+
+double integral::sum(long x0, long y0, long x1, long y1) const {
+    if (!clip(x0, y0, x1, y1))
+        return 0;
+    size_t n = (x1 - x0 + 1) * (y1 - y0 + 1);
+    return window_sum(sum1, width + 1, x0, y0, x1, y1) + n * offset;
+}
+
+double integral::sum_sq(long x0, long y0, long x1, long y1) const {
+    if (!clip(x0, y0, x1, y1))
+        return 0;
+    size_t n = (x1 - x0 + 1) * (y1 - y0 + 1);
+    double s1 = window_sum(sum1, width + 1, x0, y0, x1, y1);
+    double s2 = window_sum(sum2, width + 1, x0, y0, x1, y1);
+    // sum (d + offset)^2
+    return s2 + 2 * offset * s1 + n * offset * offset;
+}
+
+double integral::mean(long x0, long y0, long x1, long y1) const {
+    if (!clip(x0, y0, x1, y1))
+        return std::numeric_limits<double>::quiet_NaN();
+    size_t n = (x1 - x0 + 1) * (y1 - y0 + 1);
+    return window_sum(sum1, width + 1, x0, y0, x1, y1) / n + offset;
+}
+
+double integral::variance(long x0, long y0, long x1, long y1) const {
+    if (!clip(x0, y0, x1, y1))
+        return std::numeric_limits<double>::quiet_NaN();
+    size_t n = (x1 - x0 + 1) * (y1 - y0 + 1);
+    // on the centered values, the terms stay small
+    double m = window_sum(sum1, width + 1, x0, y0, x1, y1) / n;
+    double v = window_sum(sum2, width + 1, x0, y0, x1, y1) / n - m * m;
+    return v > 0 ? v : 0; // rounding errors
+}
+
+void integral::window(const point_xy_t& a, const point_xy_t& b,
+        long& x0, long& y0, long& x1, long& y1) const {
+    // same rounding as gdal::index_pix
+    x0 = std::round(a[0]);
+    y0 = std::round(a[1]);
+    x1 = std::round(b[0]);
+    y1 = std::round(b[1]);
+}
+
+double integral::mean_utm(double x0, double y0, double x1, double y1) const {
+    long px0, py0, px1, py1;
+    window(meta.point_utm2pix(x0, y0), meta.point_utm2pix(x1, y1),
+        px0, py0, px1, py1);
+    return mean(px0, py0, px1, py1);
+}
+
+double integral::variance_utm(double x0, double y0,
+        double x1, double y1) const {
+    long px0, py0, px1, py1;
+    window(meta.point_utm2pix(x0, y0), meta.point_utm2pix(x1, y1),
+        px0, py0, px1, py1);
+    return variance(px0, py0, px1, py1);
+}
+
+double integral::mean_custom(double x0, double y0,
+        double x1, double y1) const {
+    long px0, py0, px1, py1;
+    window(meta.point_custom2pix(x0, y0), meta.point_custom2pix(x1, y1),
+        px0, py0, px1, py1);
+    return mean(px0, py0, px1, py1);
+}
+
+double integral::variance_custom(double x0, double y0,
+        double x1, double y1) const {
+    long px0, py0, px1, py1;
+    window(meta.point_custom2pix(x0, y0), meta.point_custom2pix(x1, y1),
+        px0, py0, px1, py1);
+    return variance(px0, py0, px1, py1);
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,167 @@
+/*
+ * labeling.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "gdalwrap/labeling.hpp"
+#include "gdalwrap/distance.hpp" // threshold
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace gdalwrap {
+
+static inline uint32_t find_root(std::vector<uint32_t>& parent, uint32_t i) {
+    uint32_t root = i;
+    while (parent[root] != root)
+        root = parent[root];
+    // path compression
+    while (parent[i] != root) {
+        uint32_t next = parent[i];
+        parent[i] = root;
+        i = next;
+    }
+    return root;
+}
+
+/** merge the trees of a and b, the smallest index becomes the root,
+ * so that roots are the first pixel of their component in scan order
+ */
+static inline void unite(std::vector<uint32_t>& parent, uint32_t a,
+        uint32_t b) {
+    a = find_root(parent, a);
+    b = find_root(parent, b);
+    if (a < b)
+        parent[b] = a;
+    else if (b < a)
+        parent[a] = b;
+}
+
+/** label rows [y0, y1) without looking at rows outside the strip
+ */
+static void label_strip(const bytes_t& mask, std::vector<uint32_t>& parent,
+        size_t width, size_t y0, size_t y1, bool eight) {
+    for (size_t y = y0; y < y1; y++) {
+        for (size_t x = 0; x < width; x++) {
+            uint32_t i = x + y * width;
+            if (!mask[i])
+                continue;
+            parent[i] = i;
+            if (x > 0 and mask[i - 1])
+                unite(parent, i, i - 1);
+            if (y > y0)
+                for (long dx = eight ? -1 : 0; dx <= (eight ? 1 : 0); dx++) {
+                    long nx = long(x) + dx;
+                    if (nx < 0 or nx >= long(width))
+                        continue;
+                    uint32_t j = nx + (y - 1) * width;
+                    if (mask[j])
+                        unite(parent, i, j);
+                }
+        }
+    }
+}
+
+components_t connected_components(const bytes_t& mask,
+        size_t width, size_t height, labels_t& labels, bool eight) {
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    size_t size = width * height;
+    std::vector<uint32_t> parent(size, none);
+    labels.assign(size, 0);
+
+    // 1. label strips of rows in parallel
+    size_t nstrip = 1;
+#ifdef _OPENMP
+    nstrip = std::max(1, omp_get_max_threads());
+#endif
+    nstrip = std::min(nstrip, std::max<size_t>(height, 1));
+    std::vector<size_t> bounds(nstrip + 1);
+    for (size_t s = 0; s <= nstrip; s++)
+        bounds[s] = s * height / nstrip;
+    #pragma omp parallel for schedule(static, 1)
+    for (long s = 0; s < long(nstrip); s++)
+        label_strip(mask, parent, width, bounds[s], bounds[s + 1], eight);
+
+    // 2. merge the first row of each strip with the last row of the previous
+    for (size_t s = 1; s < nstrip; s++) {
+        size_t y = bounds[s];
+        if (y == 0 or y >= height)
+            continue;
+        for (size_t x = 0; x < width; x++) {
+            uint32_t i = x + y * width;
+            if (!mask[i])
+                continue;
+            for (long dx = eight ? -1 : 0; dx <= (eight ? 1 : 0); dx++) {
+                long nx = long(x) + dx;
+                if (nx < 0 or nx >= long(width))
+                    continue;
+                uint32_t j = nx + (y - 1) * width;
+                if (mask[j])
+                    unite(parent, i, j);
+            }
+        }
+    }
+
+    // 3. number the roots in scan order
+    uint32_t count = 0;
+    for (size_t i = 0; i < size; i++)
+        if (parent[i] == i)
+            labels[i] = ++count;
+
+    // 4. propagate the root labels (no write to parent, no race)
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < long(size); i++) {
+        if (parent[i] == none or parent[i] == uint32_t(i))
+            continue;
+        uint32_t root = parent[i];
+        while (parent[root] != root)
+            root = parent[root];
+        labels[i] = labels[root];
+    }
+
+    // 5. statistics
+    components_t components(count);
+    for (auto& c : components) {
+        c.area = 0;
+        c.min_x = c.min_y = std::numeric_limits<size_t>::max();
+        c.max_x = c.max_y = 0;
+        c.centroid_x = c.centroid_y = 0;
+    }
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            uint32_t l = labels[x + y * width];
+            if (l == 0)
+                continue;
+            component_t& c = components[l - 1];
+            c.area++;
+            c.min_x = std::min(c.min_x, x);
+            c.min_y = std::min(c.min_y, y);
+            c.max_x = std::max(c.max_x, x);
+            c.max_y = std::max(c.max_y, y);
+            c.centroid_x += x;
+            c.centroid_y += y;
+        }
+    }
+    for (auto& c : components) {
+        c.centroid_x /= c.area;
+        c.centroid_y /= c.area;
+    }
+    return components;
+}
+
+components_t connected_components(const gdal& map, size_t band,
+        float threshold, labels_t& labels, bool eight) {
+    return connected_components(gdalwrap::threshold(map.bands[band],
+        threshold), map.get_width(), map.get_height(), labels, eight);
+}
+
+} // namespace gdalwrap
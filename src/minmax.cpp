@@ -0,0 +1,198 @@
+/*
+ * minmax.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "gdalwrap/minmax.hpp"
+
+namespace gdalwrap {
+
+static const float nan = std::numeric_limits<float>::quiet_NaN();
+
+/** recompute the block (x, y) of level from its (up to) 4 children
+ * level 0 (cells) is only stored in lows
+ */
+void minmax::reduce(size_t level, size_t x, size_t y) {
+    const raster& clo = lows[level - 1];
+    const raster& chi = (level == 1) ? lows[0] : highs[level - 1];
+    size_t cw = widths[level - 1], ch = heights[level - 1];
+    size_t cx = 2 * x, cy = 2 * y;
+    size_t i = cx + cy * cw;
+    float lo = clo[i], hi = chi[i];
+    if (cx + 1 < cw) {
+        lo = std::min(lo, clo[i + 1]);
+        hi = std::max(hi, chi[i + 1]);
+    }
+    if (cy + 1 < ch) {
+        lo = std::min(lo, clo[i + cw]);
+        hi = std::max(hi, chi[i + cw]);
+        if (cx + 1 < cw) {
+            lo = std::min(lo, clo[i + cw + 1]);
+            hi = std::max(hi, chi[i + cw + 1]);
+        }
+    }
+    size_t j = x + y * widths[level];
+    lows[level][j] = lo;
+    highs[level][j] = hi;
+}
+
+void minmax::build(const raster& band, size_t width, size_t height) {
+    lows.assign(1, band);
+    highs.assign(1, raster());
+    widths.assign(1, width);
+    heights.assign(1, height);
+    while (widths.back() > 1 or heights.back() > 1) {
+        size_t w = (widths.back() + 1) / 2, h = (heights.back() + 1) / 2;
+        size_t level = lows.size();
+        widths.push_back(w);
+        heights.push_back(h);
+        lows.push_back(raster(w * h));
+        highs.push_back(raster(w * h));
+        #pragma omp parallel for schedule(static)
+        for (long y = 0; y < long(h); y++)
+            for (size_t x = 0; x < w; x++)
+                reduce(level, x, y);
+    }
+}
+
+void minmax::build(const gdal& map, size_t band) {
+    meta.copy_meta_only(map);
+    build(map.bands[band], map.get_width(), map.get_height());
+}
+
+void minmax::update(size_t x, size_t y, float value) {
+    lows[0][x + y * widths[0]] = value;
+    for (size_t level = 1; level < lows.size(); level++)
+        reduce(level, x >>= 1, y >>= 1);
+}
+
+bool minmax::clip(long& x0, long& y0, long& x1, long& y1) const {
+    if (lows.empty())
+        return false;
+    if (x1 < x0) std::swap(x0, x1);
+    if (y1 < y0) std::swap(y0, y1);
+    x0 = std::max(x0, 0L);
+    y0 = std::max(y0, 0L);
+    x1 = std::min(x1, long(widths[0])  - 1);
+    y1 = std::min(y1, long(heights[0]) - 1);
+    return x0 <= x1 and y0 <= y1;
+}
+
+/** depth first traversal from the root, op(lo, hi) is called for each
+ * block fully inside the window, and returns false to stop the traversal
+ */
+template <class Op>
+void minmax::visit(long x0, long y0, long x1, long y1, Op op) const {
+    if (!clip(x0, y0, x1, y1))
+        return;
+    struct node_t { size_t level, x, y; };
+    // at most 3 pending siblings per level, plus the root
+    std::vector<node_t> stack;
+    stack.reserve(4 * lows.size());
+    stack.push_back({lows.size() - 1, 0, 0});
+    while (!stack.empty()) {
+        node_t n = stack.back();
+        stack.pop_back();
+        long bx0 = long(n.x) << n.level, by0 = long(n.y) << n.level;
+        long bx1 = bx0 + (1L << n.level) - 1, by1 = by0 + (1L << n.level) - 1;
+        if (bx0 > x1 or by0 > y1 or bx1 < x0 or by1 < y0)
+            continue; // disjoint
+        if (n.level == 0) {
+            float v = lows[0][n.x + n.y * widths[0]];
+            if (!op(v, v))
+                return;
+            continue;
+        }
+        if (bx0 >= x0 and by0 >= y0 and bx1 <= x1 and by1 <= y1) {
+            size_t i = n.x + n.y * widths[n.level];
+            if (!op(lows[n.level][i], highs[n.level][i]))
+                return;
+            continue;
+        }
+        size_t cl = n.level - 1;
+        for (size_t dy = 0; dy < 2; dy++)
+            for (size_t dx = 0; dx < 2; dx++) {
+                size_t cx = 2 * n.x + dx, cy = 2 * n.y + dy;
+                if (cx < widths[cl] and cy < heights[cl])
+                    stack.push_back({cl, cx, cy});
+            }
+    }
+}
+
+float minmax::min(long x0, long y0, long x1, long y1) const {
+    float result = nan;
+    visit(x0, y0, x1, y1, [&](float lo, float) -> bool {
+        if (!(lo >= result)) // also true when result is NaN
+            result = lo;
+        return true;
+    });
+    return result;
+}
+
+float minmax::max(long x0, long y0, long x1, long y1) const {
+    float result = nan;
+    visit(x0, y0, x1, y1, [&](float, float hi) -> bool {
+        if (!(hi <= result))
+            result = hi;
+        return true;
+    });
+    return result;
+}
+
+bool minmax::any_above(long x0, long y0, long x1, long y1,
+        float threshold) const {
+    bool found = false;
+    visit(x0, y0, x1, y1, [&](float, float hi) -> bool {
+        found = hi > threshold;
+        return !found;
+    });
+    return found;
+}
+
+bool minmax::any_below(long x0, long y0, long x1, long y1,
+        float threshold) const {
+    bool found = false;
+    visit(x0, y0, x1, y1, [&](float lo, float) -> bool {
+        found = lo < threshold;
+        return !found;
+    });
+    return found;
+}
+
+float minmax::max_utm(double x0, double y0, double x1, double y1) const {
+    point_xy_t a = meta.point_utm2pix(x0, y0), b = meta.point_utm2pix(x1, y1);
+    return max(std::round(a[0]), std::round(a[1]),
+               std::round(b[0]), std::round(b[1]));
+}
+
+bool minmax::any_above_utm(double x0, double y0, double x1, double y1,
+        float threshold) const {
+    point_xy_t a = meta.point_utm2pix(x0, y0), b = meta.point_utm2pix(x1, y1);
+    return any_above(std::round(a[0]), std::round(a[1]),
+                     std::round(b[0]), std::round(b[1]), threshold);
+}
+
+float minmax::max_custom(double x0, double y0, double x1, double y1) const {
+    point_xy_t a = meta.point_custom2pix(x0, y0),
+               b = meta.point_custom2pix(x1, y1);
+    return max(std::round(a[0]), std::round(a[1]),
+               std::round(b[0]), std::round(b[1]));
+}
+
+bool minmax::any_above_custom(double x0, double y0, double x1, double y1,
+        float threshold) const {
+    point_xy_t a = meta.point_custom2pix(x0, y0),
+               b = meta.point_custom2pix(x1, y1);
+    return any_above(std::round(a[0]), std::round(a[1]),
+                     std::round(b[0]), std::round(b[1]), threshold);
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,203 @@
+/*
+ * morphology.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "gdalwrap/morphology.hpp"
+
+namespace gdalwrap {
+
+template <class T>
+struct max_op {
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T apply(T a, T b) { return a < b ? b : a; }
+};
+
+template <class T>
+struct min_op {
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T apply(T a, T b) { return b < a ? b : a; }
+};
+
+/** 1D van Herk / Gil-Werman filter of window 2 * r + 1
+ *
+ * src and dst have n samples, g and h are working buffers.
+ * Out of bounds samples are the identity of the operator.
+ */
+template <class T, class Op>
+static void vhgw1d(const T *src, T *dst, size_t n, size_t r,
+        std::vector<T>& g, std::vector<T>& h) {
+    if (r == 0) {
+        std::copy(src, src + n, dst);
+        return;
+    }
+    size_t k = 2 * r + 1;
+    size_t m = ((n + 2 * r + k - 1) / k) * k; // padded size
+    g.resize(m);
+    h.resize(m);
+    // padded input is identity for [0, r) and [r + n, m)
+    for (size_t i = 0; i < m; i++) {
+        T v = (i < r or i >= r + n) ? Op::identity() : src[i - r];
+        g[i] = (i % k == 0) ? v : Op::apply(g[i - 1], v);
+    }
+    for (size_t i = m; i-- > 0; ) {
+        T v = (i < r or i >= r + n) ? Op::identity() : src[i - r];
+        h[i] = (i % k == k - 1) ? v : Op::apply(h[i + 1], v);
+    }
+    // output i is centered on padded i + r: window [i, i + 2r]
+    for (size_t i = 0; i < n; i++)
+        dst[i] = Op::apply(h[i], g[i + 2 * r]);
+}
+
+template <class T, class Op>
+static std::vector<T> filter_rect(const std::vector<T>& band,
+        size_t width, size_t height, size_t rx, size_t ry) {
+    std::vector<T> tmp(band.size()), result(band.size());
+    long w = width, h = height;
+    // horizontal pass, row by row
+    #pragma omp parallel
+    {
+        std::vector<T> g, hh;
+        #pragma omp for schedule(static)
+        for (long y = 0; y < h; y++)
+            vhgw1d<T, Op>(band.data() + y * w, tmp.data() + y * w, w, rx,
+                g, hh);
+    }
+    if (ry == 0)
+        return tmp;
+    // vertical pass on whole rows, so the inner loop is contiguous (SIMD)
+    // blocks of k rows are independent for the prefix / suffix scans
+    long r = ry, k = 2 * r + 1;
+    long m = ((h + 2 * r + k - 1) / k) * k;
+    std::vector<T> g(m * w), hs(m * w);
+    const T id = Op::identity();
+    #pragma omp parallel for schedule(static)
+    for (long b = 0; b < m; b += k) {
+        for (long i = b; i < b + k; i++) {
+            T *gi = g.data() + i * w;
+            bool pad = (i < r or i >= r + h);
+            const T *si = pad ? NULL : tmp.data() + (i - r) * w;
+            if (i == b) {
+                for (long x = 0; x < w; x++)
+                    gi[x] = pad ? id : si[x];
+            } else {
+                const T *gp = gi - w;
+                for (long x = 0; x < w; x++)
+                    gi[x] = Op::apply(gp[x], pad ? id : si[x]);
+            }
+        }
+        for (long i = b + k - 1; i >= b; i--) {
+            T *hi = hs.data() + i * w;
+            bool pad = (i < r or i >= r + h);
+            const T *si = pad ? NULL : tmp.data() + (i - r) * w;
+            if (i == b + k - 1) {
+                for (long x = 0; x < w; x++)
+                    hi[x] = pad ? id : si[x];
+            } else {
+                const T *hn = hi + w;
+                for (long x = 0; x < w; x++)
+                    hi[x] = Op::apply(hn[x], pad ? id : si[x]);
+            }
+        }
+    }
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < h; y++) {
+        const T *hi = hs.data() + y * w;
+        const T *gi = g.data() + (y + 2 * r) * w;
+        T *out = result.data() + y * w;
+        for (long x = 0; x < w; x++)
+            out[x] = Op::apply(hi[x], gi[x]);
+    }
+    return result;
+}
+
+template <class T, class Op>
+static std::vector<T> filter_disc(const std::vector<T>& band,
+        size_t width, size_t height, double rx, double ry) {
+    long w = width, h = height;
+    long ny = std::floor(std::abs(ry));
+    // half width of the horizontal run for each row offset
+    std::vector<size_t> runs(2 * ny + 1);
+    for (long dy = -ny; dy <= ny; dy++) {
+        double t = (ry > 0) ? double(dy) / ry : 0.0;
+        runs[dy + ny] = std::floor(std::abs(rx) * std::sqrt(
+            std::max(0.0, 1.0 - t * t)) + 1e-9);
+    }
+    std::vector<T> result(band.size());
+    #pragma omp parallel
+    {
+        std::vector<T> g, hh, run(w);
+        #pragma omp for schedule(static)
+        for (long y = 0; y < h; y++) {
+            T *out = result.data() + y * w;
+            std::fill(out, out + w, Op::identity());
+            for (long dy = -ny; dy <= ny; dy++) {
+                long sy = y + dy;
+                if (sy < 0 or sy >= h)
+                    continue;
+                vhgw1d<T, Op>(band.data() + sy * w, run.data(), w,
+                    runs[dy + ny], g, hh);
+                for (long x = 0; x < w; x++)
+                    out[x] = Op::apply(out[x], run[x]);
+            }
+        }
+    }
+    return result;
+}
+
+raster dilate_rect(const raster& band, size_t width, size_t height,
+        size_t rx, size_t ry) {
+    return filter_rect<float, max_op<float>>(band, width, height, rx, ry);
+}
+bytes_t dilate_rect(const bytes_t& band, size_t width, size_t height,
+        size_t rx, size_t ry) {
+    return filter_rect<uint8_t, max_op<uint8_t>>(band, width, height, rx, ry);
+}
+raster erode_rect(const raster& band, size_t width, size_t height,
+        size_t rx, size_t ry) {
+    return filter_rect<float, min_op<float>>(band, width, height, rx, ry);
+}
+bytes_t erode_rect(const bytes_t& band, size_t width, size_t height,
+        size_t rx, size_t ry) {
+    return filter_rect<uint8_t, min_op<uint8_t>>(band, width, height, rx, ry);
+}
+
+raster dilate_disc(const raster& band, size_t width, size_t height,
+        double rx, double ry) {
+    return filter_disc<float, max_op<float>>(band, width, height, rx, ry);
+}
+bytes_t dilate_disc(const bytes_t& band, size_t width, size_t height,
+        double rx, double ry) {
+    return filter_disc<uint8_t, max_op<uint8_t>>(band, width, height, rx, ry);
+}
+raster erode_disc(const raster& band, size_t width, size_t height,
+        double rx, double ry) {
+    return filter_disc<float, min_op<float>>(band, width, height, rx, ry);
+}
+bytes_t erode_disc(const bytes_t& band, size_t width, size_t height,
+        double rx, double ry) {
+    return filter_disc<uint8_t, min_op<uint8_t>>(band, width, height, rx, ry);
+}
+
+raster dilate(const gdal& map, size_t band, double radius) {
+    return dilate_disc(map.bands[band], map.get_width(), map.get_height(),
+        radius / std::abs(map.get_scale_x()),
+        radius / std::abs(map.get_scale_y()));
+}
+
+raster erode(const gdal& map, size_t band, double radius) {
+    return erode_disc(map.bands[band], map.get_width(), map.get_height(),
+        radius / std::abs(map.get_scale_x()),
+        radius / std::abs(map.get_scale_y()));
+}
+
+} // namespace gdalwrap
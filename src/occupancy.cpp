@@ -0,0 +1,108 @@
+/*
+ * occupancy.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "gdalwrap/occupancy.hpp"
+#include "gdalwrap/atomic.hpp"
+
+namespace gdalwrap {
+
+static inline void update(float *cell, float delta, float lo, float hi) {
+    atomic_update(cell, [=](float v) -> float {
+        return std::min(hi, std::max(lo, v + delta));
+    });
+}
+
+/** clip the parameter range [t0, t1] of a + t d to [0, size] on one axis,
+ * false if empty */
+static inline bool clip(double a, double d, double size,
+        double& t0, double& t1) {
+    if (d == 0)
+        return a >= 0 and a <= size;
+    double ta = -a / d, tb = (size - a) / d;
+    if (d < 0)
+        std::swap(ta, tb);
+    t0 = std::max(t0, ta);
+    t1 = std::min(t1, tb);
+    return t0 <= t1;
+}
+
+static inline long clamp(double v, long size) {
+    return std::min(std::max(long(v), 0L), size - 1);
+}
+
+void raycast(gdal& map, size_t band, const rays_t& rays,
+        const log_odds_t& params, bool custom, bool hit_end) {
+    float *cells = map.bands[band].data();
+    const long width = map.get_width(), height = map.get_height();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (long r = 0; r < long(rays.size()); r++) {
+        const ray_t& ray = rays[r];
+        // cell centers are at integers (see gdal::index_pix), shift by
+        // half a cell so that cell boundaries are at integers
+        point_xy_t a = custom ?
+            map.point_custom2pix(ray.origin[0], ray.origin[1]) :
+            map.point_utm2pix(ray.origin[0], ray.origin[1]);
+        point_xy_t b = custom ?
+            map.point_custom2pix(ray.end[0], ray.end[1]) :
+            map.point_utm2pix(ray.end[0], ray.end[1]);
+        double ax = a[0] + 0.5, ay = a[1] + 0.5,
+               bx = b[0] + 0.5, by = b[1] + 0.5;
+        double dx = bx - ax, dy = by - ay;
+        // clip to the map [0, width] x [0, height] (slab intersection)
+        double t0 = 0, t1 = 1;
+        if ( !clip(ax, dx, width, t0, t1) or !clip(ay, dy, height, t0, t1) )
+            continue;
+        bool end_inside = t1 == 1;
+        if (t0 > 0) {
+            ax += t0 * dx;
+            ay += t0 * dy;
+        }
+        if (t1 < 1) {
+            bx = ax + (t1 - t0) * dx;
+            by = ay + (t1 - t0) * dy;
+        }
+        // points on the far border belong to the last cell
+        long x  = clamp(std::floor(ax), width),
+             y  = clamp(std::floor(ay), height),
+             ex = clamp(std::floor(bx), width),
+             ey = clamp(std::floor(by), height);
+        long sx = (dx > 0) ? 1 : -1, sy = (dy > 0) ? 1 : -1;
+        // parametric distance (t in [0, 1]) to the next boundary, and per cell
+        double tdx = (dx != 0) ? std::abs(1.0 / dx) : inf,
+               tdy = (dy != 0) ? std::abs(1.0 / dy) : inf;
+        double tx = (dx != 0) ? ((dx > 0 ? x + 1 - ax : ax - x) * tdx) : inf,
+               ty = (dy != 0) ? ((dy > 0 ? y + 1 - ay : ay - y) * tdy) : inf;
+        // at most |ex - x| + |ey - y| steps
+        long steps = std::abs(ex - x) + std::abs(ey - y);
+        for (long i = 0; i < steps; i++) {
+            if (x >= 0 and y >= 0 and x < width and y < height)
+                update(cells + x + y * width, params.miss,
+                    params.min, params.max);
+            if (tx < ty) {
+                tx += tdx;
+                x += sx;
+            } else {
+                ty += tdy;
+                y += sy;
+            }
+        }
+        if (x >= 0 and y >= 0 and x < width and y < height)
+            update(cells + x + y * width,
+                hit_end and end_inside ? params.hit : params.miss,
+                params.min, params.max);
+    }
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,181 @@
+/*
+ * overview.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <vector>
+#include <algorithm>
+#include "gdalwrap/overview.hpp"
+
+namespace gdalwrap {
+
+std::string resampling_name(reduction method) {
+    switch (method) {
+        case reduction::nearest: return "NEAREST";
+        case reduction::mean:    return "AVERAGE";
+        case reduction::min:     return "MIN";
+        case reduction::max:     return "MAX";
+        case reduction::mode:    return "MODE";
+    }
+    return "AVERAGE";
+}
+
+/** separable reduction (mean, min, max): reduce each row horizontally,
+ * then combine the rows of a block element-wise (contiguous, SIMD)
+ */
+static void reduce_separable(const raster& src, size_t width, size_t height,
+        raster& dst, size_t factor, reduction method) {
+    size_t ow = (width + factor - 1) / factor;
+    size_t oh = (height + factor - 1) / factor;
+    #pragma omp parallel
+    {
+        raster row(ow);
+        #pragma omp for schedule(static)
+        for (long oy = 0; oy < long(oh); oy++) {
+            float *out = dst.data() + oy * ow;
+            size_t y0 = oy * factor, y1 = std::min(y0 + factor, height);
+            for (size_t y = y0; y < y1; y++) {
+                const float *in = src.data() + y * width;
+                for (size_t ox = 0; ox < ow; ox++) {
+                    size_t x0 = ox * factor, x1 = std::min(x0 + factor, width);
+                    float acc = in[x0];
+                    for (size_t x = x0 + 1; x < x1; x++) {
+                        if (method == reduction::mean)
+                            acc += in[x];
+                        else if (method == reduction::min)
+                            acc = std::min(acc, in[x]);
+                        else
+                            acc = std::max(acc, in[x]);
+                    }
+                    row[ox] = acc;
+                }
+                if (y == y0) {
+                    std::copy(row.begin(), row.end(), out);
+                } else if (method == reduction::mean) {
+                    for (size_t ox = 0; ox < ow; ox++)
+                        out[ox] += row[ox];
+                } else if (method == reduction::min) {
+                    for (size_t ox = 0; ox < ow; ox++)
+                        out[ox] = std::min(out[ox], row[ox]);
+                } else {
+                    for (size_t ox = 0; ox < ow; ox++)
+                        out[ox] = std::max(out[ox], row[ox]);
+                }
+            }
+            if (method == reduction::mean) {
+                float ny = y1 - y0;
+                for (size_t ox = 0; ox < ow; ox++) {
+                    size_t x0 = ox * factor, x1 = std::min(x0 + factor, width);
+                    out[ox] /= ny * (x1 - x0);
+                }
+            }
+        }
+    }
+}
+
+static void reduce_nearest(const raster& src, size_t width, size_t height,
+        raster& dst, size_t factor) {
+    size_t ow = (width + factor - 1) / factor;
+    size_t oh = (height + factor - 1) / factor;
+    #pragma omp parallel for schedule(static)
+    for (long oy = 0; oy < long(oh); oy++) {
+        size_t y = std::min(oy * factor + factor / 2, height - 1);
+        for (size_t ox = 0; ox < ow; ox++) {
+            size_t x = std::min(ox * factor + factor / 2, width - 1);
+            dst[ox + oy * ow] = src[x + y * width];
+        }
+    }
+}
+
+/** most frequent value of each block, smallest value on ties
+ */
+static void reduce_mode(const raster& src, size_t width, size_t height,
+        raster& dst, size_t factor) {
+    size_t ow = (width + factor - 1) / factor;
+    size_t oh = (height + factor - 1) / factor;
+    #pragma omp parallel
+    {
+        raster block;
+        block.reserve(factor * factor);
+        #pragma omp for schedule(static)
+        for (long oy = 0; oy < long(oh); oy++) {
+            size_t y0 = oy * factor, y1 = std::min(y0 + factor, height);
+            for (size_t ox = 0; ox < ow; ox++) {
+                size_t x0 = ox * factor, x1 = std::min(x0 + factor, width);
+                block.clear();
+                for (size_t y = y0; y < y1; y++)
+                    block.insert(block.end(), src.begin() + x0 + y * width,
+                        src.begin() + x1 + y * width);
+                std::sort(block.begin(), block.end());
+                float best = block[0];
+                size_t best_count = 0;
+                for (size_t i = 0; i < block.size(); ) {
+                    size_t j = i + 1;
+                    while (j < block.size() and block[j] == block[i])
+                        j++;
+                    if (j - i > best_count) {
+                        best_count = j - i;
+                        best = block[i];
+                    }
+                    i = j;
+                }
+                dst[ox + oy * ow] = best;
+            }
+        }
+    }
+}
+
+gdal overview(const gdal& map, size_t factor, reduction method) {
+    if (factor < 1)
+        throw std::invalid_argument("[gdal] overview factor must be >= 1");
+    size_t width = map.get_width(), height = map.get_height();
+    size_t ow = (width + factor - 1) / factor;
+    size_t oh = (height + factor - 1) / factor;
+    gdal result;
+    result.copy_meta(map, ow, oh);
+    // cell centers are at integers: the first block is centered on the
+    // source pixel ((factor - 1) / 2, (factor - 1) / 2)
+    point_xy_t origin = map.point_pix2utm((factor - 1) / 2.0,
+        (factor - 1) / 2.0);
+    result.set_transform(origin[0], origin[1],
+        map.get_scale_x() * factor, map.get_scale_y() * factor);
+    if (width == 0 or height == 0)
+        return result;
+    for (size_t band = 0; band < map.bands.size(); band++) {
+        switch (method) {
+            case reduction::nearest:
+                reduce_nearest(map.bands[band], width, height,
+                    result.bands[band], factor);
+                break;
+            case reduction::mode:
+                reduce_mode(map.bands[band], width, height,
+                    result.bands[band], factor);
+                break;
+            default:
+                reduce_separable(map.bands[band], width, height,
+                    result.bands[band], factor, method);
+        }
+    }
+    return result;
+}
+
+std::vector<gdal> overviews(const gdal& map, size_t levels,
+        reduction method) {
+    std::vector<gdal> result;
+    result.reserve(levels);
+    for (size_t level = 0; level < levels; level++) {
+        if (method == reduction::mode)
+            result.push_back(overview(map, 2 << level, method));
+        else
+            result.push_back(overview(level ? result.back() : map, 2,
+                method));
+    }
+    return result;
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,264 @@
+/*
+ * polygon.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>        // for invalid_argument
+#include <ogr_geometry.h>   // for OGRPolygon, OGRMultiPolygon
+
+#include "gdalwrap/polygon.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace gdalwrap {
+
+struct edge_t {
+    double x0, y0;  // lower end (y0 < y1)
+    double dxdy;
+    long r0, r1;    // first and last row crossed (cell centers)
+};
+
+static void fill_polygon(raster& band, size_t width, size_t height,
+        const polygon_t& polygon, float value) {
+    // edges crossing at least one row of cell centers, half-open [y0, y1[
+    std::vector<edge_t> edges;
+    for (const auto& ring : polygon) {
+        for (size_t k = 0; k < ring.size(); k++) {
+            const point_xy_t& a = ring[k];
+            const point_xy_t& b = ring[(k + 1) % ring.size()];
+            if (a[1] == b[1])
+                continue;
+            const point_xy_t& lo = a[1] < b[1] ? a : b;
+            const point_xy_t& hi = a[1] < b[1] ? b : a;
+            edge_t e;
+            e.x0 = lo[0];
+            e.y0 = lo[1];
+            e.dxdy = (hi[0] - lo[0]) / (hi[1] - lo[1]);
+            e.r0 = std::max(0.0, std::ceil(lo[1]));
+            e.r1 = std::min(height - 1.0, std::ceil(hi[1]) - 1);
+            if (e.r0 <= e.r1)
+                edges.push_back(e);
+        }
+    }
+    if (edges.empty())
+        return;
+    std::sort(edges.begin(), edges.end(),
+        [](const edge_t& a, const edge_t& b) { return a.r0 < b.r0; });
+
+    size_t nstrip = 1;
+#ifdef _OPENMP
+    nstrip = std::max(1, omp_get_max_threads());
+#endif
+    nstrip = std::min(nstrip, std::max<size_t>(height, 1));
+    #pragma omp parallel for schedule(static, 1)
+    for (long s = 0; s < long(nstrip); s++) {
+        long ya = s * height / nstrip, yb = (s + 1) * height / nstrip;
+        std::vector<const edge_t*> active;
+        std::vector<double> xs;
+        size_t next = 0;
+        // edges starting above the strip and still active in it
+        for (; next < edges.size() and edges[next].r0 < ya; next++)
+            if (edges[next].r1 >= ya)
+                active.push_back(&edges[next]);
+        for (long y = ya; y < yb; y++) {
+            for (; next < edges.size() and edges[next].r0 == y; next++)
+                active.push_back(&edges[next]);
+            active.erase(std::remove_if(active.begin(), active.end(),
+                [y](const edge_t* e) { return e->r1 < y; }), active.end());
+            xs.clear();
+            for (const edge_t* e : active)
+                xs.push_back(e->x0 + (y - e->y0) * e->dxdy);
+            std::sort(xs.begin(), xs.end());
+            // even-odd: cells with a center in [xs[k], xs[k+1][
+            for (size_t k = 0; k + 1 < xs.size(); k += 2) {
+                long x0 = std::max(0.0, std::ceil(xs[k]));
+                long x1 = std::min(width - 1.0, std::ceil(xs[k + 1]) - 1);
+                for (long x = x0; x <= x1; x++)
+                    band[x + y * width] = value;
+            }
+        }
+    }
+}
+
+void rasterize(raster& band, size_t width, size_t height,
+        const polygons_t& polygons, float value) {
+    for (const auto& polygon : polygons)
+        fill_polygon(band, width, height, polygon, value);
+}
+
+void rasterize(gdal& map, size_t band, const polygons_t& polygons,
+        float value, bool custom) {
+    polygons_t pixels(polygons);
+    for (auto& polygon : pixels)
+        for (auto& ring : polygon)
+            for (auto& p : ring)
+                p = custom ? map.point_custom2pix(p[0], p[1])
+                           : map.point_utm2pix(p[0], p[1]);
+    rasterize(map.bands[band], map.get_width(), map.get_height(), pixels,
+        value);
+}
+
+static points_xy_t ring_points(const OGRLinearRing* ring) {
+    points_xy_t points(ring->getNumPoints());
+    for (int k = 0; k < ring->getNumPoints(); k++)
+        points[k] = {{ ring->getX(k), ring->getY(k) }};
+    return points;
+}
+
+static polygon_t ogr_polygon(const OGRPolygon* geometry) {
+    polygon_t polygon;
+    if (geometry->getExteriorRing() == NULL)
+        return polygon;
+    polygon.push_back(ring_points(geometry->getExteriorRing()));
+    for (int k = 0; k < geometry->getNumInteriorRings(); k++)
+        polygon.push_back(ring_points(geometry->getInteriorRing(k)));
+    return polygon;
+}
+
+void rasterize(gdal& map, size_t band, const OGRGeometry* geometry,
+        float value) {
+    polygons_t polygons;
+    switch (wkbFlatten(geometry->getGeometryType())) {
+    case wkbPolygon:
+        polygons.push_back(ogr_polygon(
+            static_cast<const OGRPolygon*>(geometry)));
+        break;
+    case wkbMultiPolygon: {
+        const OGRMultiPolygon* multi =
+            static_cast<const OGRMultiPolygon*>(geometry);
+        for (int k = 0; k < multi->getNumGeometries(); k++)
+            polygons.push_back(ogr_polygon(
+                static_cast<const OGRPolygon*>(multi->getGeometryRef(k))));
+        break;
+    }
+    default:
+        throw std::invalid_argument("[polygon] not a (multi) polygon");
+    }
+    rasterize(map, band, polygons, value);
+}
+
+/* Cell sides: 0 top, 1 right, 2 bottom, 3 left, walked clockwise (y down)
+ * so that the region is on the right.
+ */
+static const int nx4[4] = { 0, 1, 0, -1 }; // outward normal of each side
+static const int ny4[4] = { -1, 0, 1, 0 };
+static const int cx4[4] = { 0, 1, 1, 0 };  // start corner of each side
+static const int cy4[4] = { 0, 0, 1, 1 };
+
+/** signed area of a closed ring, > 0 if clockwise in pixels (y down) */
+static double signed_area(const points_xy_t& ring) {
+    double area = 0;
+    for (size_t k = 0; k + 1 < ring.size(); k++)
+        area += ring[k][0] * ring[k + 1][1] - ring[k + 1][0] * ring[k][1];
+    return area / 2;
+}
+
+regions_t polygonize(const std::vector<uint32_t>& labels, size_t width,
+        size_t height) {
+    const long w = width, h = height;
+    auto label = [&](long x, long y) -> uint32_t {
+        return (x < 0 or y < 0 or x >= w or y >= h) ? 0 : labels[x + y * w];
+    };
+    auto boundary = [&](long x, long y, int s) {
+        return label(x + nx4[s], y + ny4[s]) != labels[x + y * w];
+    };
+    bytes_t visited(width * height, 0); // 4 bits per cell, one per side
+    // region of each cell, set by a flood fill when its exterior is found
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> region_of(width * height, none);
+    std::vector<long> stack;
+    regions_t regions;
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            uint32_t l = labels[x + y * w];
+            if (l == 0)
+                continue;
+            for (int s = 0; s < 4; s++) {
+                if ((visited[x + y * w] >> s & 1) or !boundary(x, y, s))
+                    continue;
+                points_xy_t ring;
+                long cx = x, cy = y;
+                int cs = s, previous = -1;
+                do {
+                    visited[cx + cy * w] |= 1 << cs;
+                    if (cs != previous) // corner: direction changes
+                        ring.push_back({{ cx + cx4[cs] - 0.5,
+                                          cy + cy4[cs] - 0.5 }});
+                    previous = cs;
+                    // next side: convex corner, straight or concave
+                    int s1 = (cs + 1) % 4;
+                    if (boundary(cx, cy, s1)) {
+                        cs = s1;
+                        continue;
+                    }
+                    cx += nx4[s1];
+                    cy += ny4[s1];
+                    if (boundary(cx, cy, cs))
+                        continue;
+                    cx += nx4[cs];
+                    cy += ny4[cs];
+                    cs = (cs + 3) % 4;
+                } while (!(cx == x and cy == y and cs == s));
+                // the first side may be in the middle of a straight line
+                size_t n = ring.size();
+                if (n > 2 and (ring[n - 1][0] == ring[1][0] or
+                               ring[n - 1][1] == ring[1][1]))
+                    ring.erase(ring.begin());
+                ring.push_back(ring.front());
+                if (signed_area(ring) < 0) {
+                    // hole: (x, y) is inside the region enclosing it, whose
+                    // exterior was found first, in raster order
+                    regions[region_of[x + y * w]].rings.push_back(
+                        std::move(ring));
+                    continue;
+                }
+                // exterior: flood fill its 4-connected area
+                uint32_t r = regions.size();
+                regions.push_back(region_t{ l, polygon_t{ std::move(ring) } });
+                region_of[x + y * w] = r;
+                stack.push_back(x + y * w);
+                while (!stack.empty()) {
+                    long i = stack.back(), ix = i % w, iy = i / w;
+                    stack.pop_back();
+                    for (int d = 0; d < 4; d++) {
+                        long jx = ix + nx4[d], jy = iy + ny4[d];
+                        if (label(jx, jy) == l and
+                                region_of[jx + jy * w] == none) {
+                            region_of[jx + jy * w] = r;
+                            stack.push_back(jx + jy * w);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return regions;
+}
+
+regions_t polygonize(const gdal& map, size_t band, bool custom) {
+    const raster& data = map.bands[band];
+    std::vector<uint32_t> labels(data.size());
+    for (size_t i = 0; i < data.size(); i++)
+        labels[i] = (data[i] > 0) ? uint32_t(std::round(data[i])) : 0;
+    regions_t regions = polygonize(labels, map.get_width(),
+        map.get_height());
+    for (auto& region : regions)
+        for (auto& ring : region.rings)
+            for (auto& p : ring)
+                p = custom ? map.point_pix2custom(p[0], p[1])
+                           : map.point_pix2utm(p[0], p[1]);
+    return regions;
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,69 @@
+/*
+ * profile.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "gdalwrap/profile.hpp"
+
+namespace gdalwrap {
+
+raster profile(const gdal& map, size_t band, const points_xy_t& polyline,
+        double step, bool custom, float no_data) {
+    if ( !(step > 0) )
+        throw std::invalid_argument("[gdal] profile step must be > 0");
+    const raster& data = map.bands[band];
+    size_t width = map.get_width(), height = map.get_height();
+    double sx = map.get_scale_x(), sy = map.get_scale_y();
+    raster result;
+    if (polyline.empty())
+        return result;
+    // samples are at k * step of curvilinear abscissa (s0 at a); those
+    // within a rounding error of a vertex go to the next segment, and
+    // the last vertex is added at the end (no duplicate)
+    double s0 = 0;
+    size_t k = 0;
+    point_xy_t a = custom ?
+        map.point_custom2pix(polyline[0][0], polyline[0][1]) :
+        map.point_utm2pix(polyline[0][0], polyline[0][1]);
+    for (size_t i = 1; i < polyline.size(); i++) {
+        point_xy_t b = custom ?
+            map.point_custom2pix(polyline[i][0], polyline[i][1]) :
+            map.point_utm2pix(polyline[i][0], polyline[i][1]);
+        double dx = b[0] - a[0], dy = b[1] - a[1];
+        double length = std::sqrt(dx * sx * dx * sx + dy * sy * dy * sy);
+        if (length > 0) {
+            double s1 = s0 + length;
+            size_t end = std::ceil(s1 / step - 1e-9);
+            // pixel increment per sample
+            double ix = dx * step / length, iy = dy * step / length;
+            double x = a[0] + dx * (k * step - s0) / length,
+                   y = a[1] + dy * (k * step - s0) / length;
+            for (; k < end; k++, x += ix, y += iy)
+                result.push_back(bilinear(data, width, height, x, y, no_data));
+            s0 = s1;
+        }
+        a = b;
+    }
+    // last vertex
+    result.push_back(bilinear(data, width, height, a[0], a[1], no_data));
+    return result;
+}
+
+rasters profiles(const gdal& map, size_t band,
+        const std::vector<points_xy_t>& polylines, double step,
+        bool custom, float no_data) {
+    rasters result(polylines.size());
+    #pragma omp parallel for schedule(dynamic, 4)
+    for (long i = 0; i < long(polylines.size()); i++)
+        result[i] = profile(map, band, polylines[i], step, custom, no_data);
+    return result;
+}
+
+} // namespace gdalwrap
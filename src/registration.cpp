@@ -0,0 +1,222 @@
+/*
+ * registration.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include "gdalwrap/registration.hpp"
+
+namespace gdalwrap {
+
+typedef std::complex<double> complex_t;
+
+static size_t next_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+/** in place iterative radix-2 FFT of n values (power of 2), stride s */
+static void fft(complex_t* data, size_t n, size_t s, bool inverse) {
+    // bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(data[i * s], data[j * s]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        double angle = 2 * M_PI / len * (inverse ? 1 : -1);
+        complex_t wlen(std::cos(angle), std::sin(angle));
+        for (size_t i = 0; i < n; i += len) {
+            complex_t w(1);
+            for (size_t j = 0; j < len / 2; j++) {
+                complex_t u = data[(i + j) * s];
+                complex_t v = data[(i + j + len / 2) * s] * w;
+                data[(i + j) * s] = u + v;
+                data[(i + j + len / 2) * s] = u - v;
+                w *= wlen;
+            }
+        }
+    }
+}
+
+/** 2D FFT of a nx * ny grid (powers of 2), rows then columns in parallel */
+static void fft2(std::vector<complex_t>& grid, size_t nx, size_t ny,
+        bool inverse) {
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < long(ny); y++)
+        fft(grid.data() + y * nx, nx, 1, inverse);
+    #pragma omp parallel for schedule(static)
+    for (long x = 0; x < long(nx); x++)
+        fft(grid.data() + x, ny, nx, inverse);
+}
+
+/** centered, windowed and zero padded copy of a raster */
+static std::vector<complex_t> prepare(const raster& band, size_t width,
+        size_t height, size_t nx, size_t ny, float no_data) {
+    auto valid = [no_data](float v) {
+        return !std::isnan(v) and v != no_data;
+    };
+    double mean = 0;
+    size_t n = 0;
+    for (float v : band)
+        if (valid(v)) {
+            mean += v;
+            n++;
+        }
+    if (n > 0)
+        mean /= n;
+    std::vector<complex_t> grid(nx * ny, 0);
+    for (size_t y = 0; y < height; y++) {
+        double wy = height > 1 ? 0.5 - 0.5 * std::cos(2 * M_PI * y /
+            (height - 1)) : 1;
+        for (size_t x = 0; x < width; x++) {
+            double wx = width > 1 ? 0.5 - 0.5 * std::cos(2 * M_PI * x /
+                (width - 1)) : 1;
+            float v = band[x + y * width];
+            grid[x + y * nx] = valid(v) ? (v - mean) * wx * wy : 0;
+        }
+    }
+    return grid;
+}
+
+/** sub-pixel offset of a peak from its 2 neighbours
+ *
+ * A sharp peak is a sampled sinc (Foroosh et al.): of the solutions
+ * n / (n + c) and n / (n - c) from the higher neighbour n, keep the one in
+ * [0, 1] towards n, if its sinc also predicts the other neighbour. Peaks
+ * widened by smooth data are not sincs, fit a parabola instead.
+ */
+static double subpixel(double left, double center, double right) {
+    if (center <= 0)
+        return 0;
+    double side = right > left ? 1 : -1;
+    double n = std::max(left, right), o = std::min(left, right);
+    double d = -1;
+    for (double c : { n / (n + center), n / (n - center) })
+        if (c >= 0 and c <= 1) {
+            d = c;
+            break;
+        }
+    // sinc(1 + d) / sinc(d) = -d / (1 + d)
+    if (d >= 0 and std::abs(o / center + d / (1 + d)) < 0.2)
+        d *= side;
+    else {
+        double curvature = 2 * center - left - right;
+        d = curvature > 0 ? (right - left) / (2 * curvature) : 0;
+    }
+    return std::max(-0.5, std::min(0.5, d));
+}
+
+point_xy_t phase_correlation(const raster& reference, const raster& moving,
+        size_t width, size_t height, float no_data, double* peak) {
+    point_xy_t shift = {{0, 0}};
+    if (peak)
+        *peak = 0;
+    if (width == 0 or height == 0)
+        return shift;
+    size_t nx = next_pow2(width), ny = next_pow2(height);
+    std::vector<complex_t> f = prepare(reference, width, height, nx, ny,
+        no_data);
+    std::vector<complex_t> g = prepare(moving, width, height, nx, ny,
+        no_data);
+    fft2(f, nx, ny, false);
+    fft2(g, nx, ny, false);
+    // normalized cross-power spectrum: conj(F) G / |conj(F) G|, regularized
+    // so that frequencies without energy (smooth terrain) do not whiten
+    // rounding noise into the correlation
+    double norm_max = 0;
+    #pragma omp parallel for schedule(static) reduction(max:norm_max)
+    for (long i = 0; i < long(nx * ny); i++) {
+        f[i] = std::conj(f[i]) * g[i];
+        norm_max = std::max(norm_max, std::abs(f[i]));
+    }
+    const double eps = 1e-3 * norm_max;
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < long(nx * ny); i++) {
+        double norm = std::abs(f[i]);
+        f[i] = norm > 0 ? f[i] / (norm + eps) : 0;
+    }
+    fft2(f, nx, ny, true);
+    size_t best = 0;
+    for (size_t i = 1; i < nx * ny; i++)
+        if (f[i].real() > f[best].real())
+            best = i;
+    long px = best % nx, py = best / nx;
+    auto at = [&](long x, long y) {
+        x = (x + nx) % nx;
+        y = (y + ny) % ny;
+        return f[x + y * nx].real();
+    };
+    double center = at(px, py);
+    double dx = subpixel(at(px - 1, py), center, at(px + 1, py));
+    double dy = subpixel(at(px, py - 1), center, at(px, py + 1));
+    // peaks above half the size are negative shifts (circular)
+    if (px > long(nx / 2))
+        px -= nx;
+    if (py > long(ny / 2))
+        py -= ny;
+    shift[0] = px + dx;
+    shift[1] = py + dy;
+    if (peak)
+        *peak = center / (nx * ny);
+    return shift;
+}
+
+point_xy_t register_translation(const gdal& reference, size_t band_reference,
+        const gdal& moving, size_t band_moving, float no_data,
+        double* peak) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    point_xy_t offset = {{0, 0}};
+    if (peak)
+        *peak = 0;
+    // extent of moving in the pixel frame of reference (cell borders)
+    long mw = moving.get_width(), mh = moving.get_height();
+    point_xy_t c0 = moving.point_pix2utm(-0.5, -0.5);
+    point_xy_t c1 = moving.point_pix2utm(mw - 0.5, mh - 0.5);
+    point_xy_t p0 = reference.point_utm2pix(c0[0], c0[1]);
+    point_xy_t p1 = reference.point_utm2pix(c1[0], c1[1]);
+    long x0 = std::max(0.0, std::ceil(std::min(p0[0], p1[0]) - 0.5)),
+         y0 = std::max(0.0, std::ceil(std::min(p0[1], p1[1]) - 0.5)),
+         x1 = std::min(reference.get_width() - 1.0,
+                       std::floor(std::max(p0[0], p1[0]) - 0.5)),
+         y1 = std::min(reference.get_height() - 1.0,
+                       std::floor(std::max(p0[1], p1[1]) - 0.5));
+    if (x1 < x0 or y1 < y0)
+        return offset;
+    const long width = x1 - x0 + 1, height = y1 - y0 + 1;
+    const raster& r = reference.bands[band_reference];
+    const raster& m = moving.bands[band_moving];
+    raster a(width * height), b(width * height);
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < height; y++) {
+        for (long x = 0; x < width; x++) {
+            a[x + y * width] = r[(x + x0) + (y + y0) *
+                reference.get_width()];
+            point_xy_t utm = reference.point_pix2utm(x + x0, y + y0);
+            size_t k = moving.index_utm(utm[0], utm[1]);
+            b[x + y * width] = k == std::numeric_limits<size_t>::max() ?
+                nan : m[k];
+        }
+    }
+    point_xy_t shift = phase_correlation(a, b, width, height, no_data, peak);
+    // moving shows at p + shift what is at p: move its origin back
+    offset[0] = -shift[0] * reference.get_scale_x();
+    offset[1] = -shift[1] * reference.get_scale_y();
+    return offset;
+}
+
+} // namespace gdalwrap
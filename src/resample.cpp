@@ -0,0 +1,204 @@
+/*
+ * resample.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>        // for invalid_argument
+#include "gdalwrap/resample.hpp"
+
+namespace gdalwrap {
+
+/** weights of one dimension: output i = sum_k weights[k] * input[start + k]
+ */
+struct coefs_t {
+    std::vector<size_t> start;
+    std::vector<size_t> count;
+    std::vector<double> weights; // count_max per output sample
+    size_t count_max;
+};
+
+static double sinc(double x) {
+    if (x == 0)
+        return 1;
+    x *= M_PI;
+    return std::sin(x) / x;
+}
+
+static double support(interpolation method) {
+    switch (method) {
+        case interpolation::bilinear: return 1;
+        case interpolation::bicubic:  return 2;
+        case interpolation::lanczos:  return 3;
+        default:                      return 0.5;
+    }
+}
+
+static double kernel(interpolation method, double x) {
+    x = std::abs(x);
+    switch (method) {
+        case interpolation::bilinear:
+            return x < 1 ? 1 - x : 0;
+        case interpolation::bicubic: { // Keys, a = -0.5
+            const double a = -0.5;
+            if (x < 1)
+                return ((a + 2) * x - (a + 3)) * x * x + 1;
+            if (x < 2)
+                return (((x - 5) * x + 8) * x - 4) * a;
+            return 0;
+        }
+        case interpolation::lanczos:
+            return x < 3 ? sinc(x) * sinc(x / 3) : 0;
+        default:
+            return x < 0.5 ? 1 : 0;
+    }
+}
+
+/** weights for out samples every ratio input pixels, the first one
+ * centered at (ratio - 1) / 2 (cell borders -0.5 aligned), clamped
+ */
+static coefs_t precompute(size_t in, size_t out, double ratio,
+        interpolation method) {
+    coefs_t c;
+    double scale = std::max(ratio, 1.0); // stretch the kernel to downsample
+    double radius = support(method) * scale;
+    if (method == interpolation::nearest)
+        radius = 0.5;
+    c.count_max = std::ceil(radius) * 2 + 1;
+    c.start.resize(out);
+    c.count.resize(out);
+    c.weights.assign(out * c.count_max, 0.0);
+    for (size_t i = 0; i < out; i++) {
+        double center = (i + 0.5) * ratio; // in input pixel coordinates
+        double *w = c.weights.data() + i * c.count_max;
+        if (method == interpolation::nearest) {
+            c.start[i] = std::min(size_t(center), in - 1);
+            c.count[i] = 1;
+            w[0] = 1;
+            continue;
+        }
+        long x0 = std::max(0L, long(std::floor(center - radius)));
+        long x1 = std::min(long(in), long(std::ceil(center + radius)));
+        x1 = std::min(x1, x0 + long(c.count_max));
+        double total = 0;
+        for (long x = x0; x < x1; x++) {
+            double v;
+            if (method == interpolation::area) // overlap of [x, x + 1]
+                v = std::max(0.0, std::min(x + 1.0, center + ratio / 2) -
+                                  std::max(double(x), center - ratio / 2));
+            else
+                v = kernel(method, (x + 0.5 - center) / scale);
+            w[x - x0] = v;
+            total += v;
+        }
+        if (total == 0) { // past the border: clamp to the closest cell
+            x0 = std::min(std::max(0L, long(center)), long(in) - 1);
+            x1 = x0 + 1;
+            w[0] = 1;
+            std::fill(w + 1, w + c.count_max, 0.0);
+        } else {
+            for (long x = x0; x < x1; x++)
+                w[x - x0] /= total;
+        }
+        c.start[i] = x0;
+        c.count[i] = x1 - x0;
+    }
+    return c;
+}
+
+static raster resize(const raster& band, size_t width, size_t height,
+        size_t new_width, size_t new_height, double ratio_x, double ratio_y,
+        interpolation method) {
+    raster result(new_width * new_height);
+    if (width == 0 or height == 0 or new_width == 0 or new_height == 0)
+        return result;
+    coefs_t cx = precompute(width, new_width, ratio_x, method);
+    coefs_t cy = precompute(height, new_height, ratio_y, method);
+    // horizontal pass on every input row
+    raster tmp(new_width * height);
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < long(height); y++) {
+        const float *in = band.data() + y * width;
+        float *out = tmp.data() + y * new_width;
+        for (size_t x = 0; x < new_width; x++) {
+            const double *w = cx.weights.data() + x * cx.count_max;
+            const float *src = in + cx.start[x];
+            double acc = 0;
+            for (size_t k = 0; k < cx.count[x]; k++)
+                acc += w[k] * src[k];
+            out[x] = acc;
+        }
+    }
+    // vertical pass, weighted sum of rows (contiguous, SIMD)
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < long(new_height); y++) {
+        const double *w = cy.weights.data() + y * cy.count_max;
+        float *out = result.data() + y * new_width;
+        for (size_t k = 0; k < cy.count[y]; k++) {
+            const float *src = tmp.data() + (cy.start[y] + k) * new_width;
+            float wk = w[k];
+            if (k == 0)
+                for (size_t x = 0; x < new_width; x++)
+                    out[x] = wk * src[x];
+            else
+                for (size_t x = 0; x < new_width; x++)
+                    out[x] += wk * src[x];
+        }
+    }
+    return result;
+}
+
+raster resize(const raster& band, size_t width, size_t height,
+        size_t new_width, size_t new_height, interpolation method) {
+    if (new_width == 0 or new_height == 0)
+        return raster();
+    return resize(band, width, height, new_width, new_height,
+        double(width) / new_width, double(height) / new_height, method);
+}
+
+/** resample with ratio = new scale / old scale, the geotransform matches
+ * the sample positions: cell centers are at integer pixels (index_pix),
+ * so the new origin (center of the new cell 0) moves by (ratio - 1) / 2
+ */
+static gdal resample(const gdal& map, size_t width, size_t height,
+        double ratio_x, double ratio_y, interpolation method) {
+    gdal result;
+    result.copy_meta(map, width, height);
+    point_xy_t origin = map.point_pix2utm((ratio_x - 1) / 2,
+                                          (ratio_y - 1) / 2);
+    result.set_transform(origin[0], origin[1],
+        map.get_scale_x() * ratio_x, map.get_scale_y() * ratio_y);
+    for (size_t band = 0; band < map.bands.size(); band++)
+        result.bands[band] = resize(map.bands[band], map.get_width(),
+            map.get_height(), width, height, ratio_x, ratio_y, method);
+    return result;
+}
+
+gdal resize(const gdal& map, size_t width, size_t height,
+        interpolation method) {
+    if (width == 0 or height == 0)
+        throw std::invalid_argument("[resample] empty target size");
+    return resample(map, width, height, double(map.get_width()) / width,
+        double(map.get_height()) / height, method);
+}
+
+gdal resample(const gdal& map, double scale_x, double scale_y,
+        interpolation method) {
+    if (!(std::abs(scale_x) > 0 and std::abs(scale_y) > 0))
+        throw std::invalid_argument("[resample] null target scale");
+    // magnitudes: the signs (orientation) of the map are kept
+    double ratio_x = std::abs(scale_x / map.get_scale_x()),
+           ratio_y = std::abs(scale_y / map.get_scale_y());
+    size_t width = std::max(1.0, std::round(map.get_width() / ratio_x));
+    size_t height = std::max(1.0, std::round(map.get_height() / ratio_y));
+    return resample(map, width, height, ratio_x, ratio_y, method);
+}
+
+} // namespace gdalwrap
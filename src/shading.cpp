@@ -0,0 +1,161 @@
+/*
+ * shading.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "gdalwrap/shading.hpp"
+
+namespace gdalwrap {
+
+const std::string normal_x = "NORMAL_X";
+const std::string normal_y = "NORMAL_Y";
+const std::string normal_z = "NORMAL_Z";
+
+/** Horn 3x3 stencil: op(first, dz/dx, dz/dy, n) for each row
+ *
+ * Gradients are per meter along the signed scale (east, north for a
+ * north-up map), computed in row buffers. Border rows and columns are
+ * clamped and divided by their span (exact on a plane), so the
+ * interior loops have no branch and vectorize. A NaN cell gives a NaN
+ * gradient to itself too, though it has no weight in its own stencil.
+ */
+template <class Op>
+static void stencil(const raster& dem, size_t width, size_t height,
+        double scale_x, double scale_y, float z_factor, Op op) {
+    const long w = width, h = height;
+    if (w == 0 or h == 0)
+        return;
+    const float kx = z_factor / (8 * scale_x),
+                ky = z_factor / (8 * scale_y);
+    #pragma omp parallel
+    {
+        std::vector<float> gx_row(w), gy_row(w);
+        float *gx = gx_row.data(), *gy = gy_row.data();
+        #pragma omp for schedule(static)
+        for (long y = 0; y < h; y++) {
+            const float *up   = dem.data() + std::max(y - 1, 0L) * w;
+            const float *mid  = dem.data() + y * w;
+            const float *down = dem.data() + std::min(y + 1, h - 1) * w;
+            // rows apart: 2 inside, 1 on the border, 0 if a single row
+            long dy = std::min(y + 1, h - 1) - std::max(y - 1, 0L);
+            const float ky_row = dy > 0 ? ky * 2 / dy : 0;
+            for (long x : { 0L, w - 1 }) { // clamped columns
+                long x0 = std::max(x - 1, 0L), x1 = std::min(x + 1, w - 1);
+                float kx_col = x1 > x0 ? kx * 2 / (x1 - x0) : 0;
+                gx[x] = ((up[x1] + 2 * mid[x1] + down[x1]) -
+                         (up[x0] + 2 * mid[x0] + down[x0])) * kx_col +
+                        (mid[x] - mid[x]); // NaN center: not in the stencil
+                gy[x] = ((down[x0] + 2 * down[x] + down[x1]) -
+                         (up[x0] + 2 * up[x] + up[x1])) * ky_row;
+            }
+            #pragma omp simd
+            for (long x = 1; x < w - 1; x++) {
+                gx[x] = ((up[x + 1] + 2 * mid[x + 1] + down[x + 1]) -
+                         (up[x - 1] + 2 * mid[x - 1] + down[x - 1])) * kx +
+                        (mid[x] - mid[x]);
+                gy[x] = ((down[x - 1] + 2 * down[x] + down[x + 1]) -
+                         (up[x - 1] + 2 * up[x] + up[x + 1])) * ky_row;
+            }
+            op(y * w, gx, gy, w);
+        }
+    }
+}
+
+static inline uint8_t to_byte(float v) { // [-1,1] to [0,255], NaN to 0
+    float b = (v * 0.5f + 0.5f) * 255 + 0.5f;
+    return b > 0 ? uint8_t(std::min(b, 255.0f)) : 0;
+}
+
+gdal normals(const gdal& map, size_t band, float z_factor) {
+    gdal result;
+    result.copy_meta(map, 3);
+    result.names = { normal_x, normal_y, normal_z };
+    float *nx = result.bands[0].data(), *ny = result.bands[1].data(),
+          *nz = result.bands[2].data();
+    stencil(map.bands[band], map.get_width(), map.get_height(),
+        map.get_scale_x(), map.get_scale_y(), z_factor,
+        [=](size_t first, const float* gx, const float* gy, long n) {
+            #pragma omp simd
+            for (long x = 0; x < n; x++) {
+                float inv = 1 / std::sqrt(gx[x] * gx[x] + gy[x] * gy[x] + 1);
+                nx[first + x] = -gx[x] * inv;
+                ny[first + x] = -gy[x] * inv;
+                nz[first + x] = inv;
+            }
+        });
+    return result;
+}
+
+std::vector<bytes_t> normal_map(const gdal& map, size_t band,
+        bool octahedral, float z_factor) {
+    size_t size = map.get_width() * map.get_height();
+    std::vector<bytes_t> result(octahedral ? 2 : 3, bytes_t(size));
+    uint8_t *b0 = result[0].data(), *b1 = result[1].data(),
+            *b2 = octahedral ? NULL : result[2].data();
+    if (octahedral) {
+        // the normal is projected on the octahedron |x| + |y| + |z| = 1,
+        // terrain normals point up (z > 0) so no folding is needed
+        stencil(map.bands[band], map.get_width(), map.get_height(),
+            map.get_scale_x(), map.get_scale_y(), z_factor,
+            [=](size_t first, const float* gx, const float* gy, long n) {
+                #pragma omp simd
+                for (long x = 0; x < n; x++) {
+                    float inv = 1 / (std::abs(gx[x]) + std::abs(gy[x]) + 1);
+                    b0[first + x] = to_byte(-gx[x] * inv);
+                    b1[first + x] = to_byte(-gy[x] * inv);
+                }
+            });
+    } else {
+        stencil(map.bands[band], map.get_width(), map.get_height(),
+            map.get_scale_x(), map.get_scale_y(), z_factor,
+            [=](size_t first, const float* gx, const float* gy, long n) {
+                #pragma omp simd
+                for (long x = 0; x < n; x++) {
+                    float inv = 1 / std::sqrt(gx[x] * gx[x] +
+                                              gy[x] * gy[x] + 1);
+                    b0[first + x] = to_byte(-gx[x] * inv);
+                    b1[first + x] = to_byte(-gy[x] * inv);
+                    b2[first + x] = to_byte(inv);
+                }
+            });
+    }
+    return result;
+}
+
+bytes_t hillshade(const raster& dem, size_t width, size_t height,
+        double scale_x, double scale_y, double azimuth, double altitude,
+        float z_factor) {
+    const double az = azimuth * M_PI / 180, alt = altitude * M_PI / 180;
+    // light direction (east, north, up), scaled to bytes
+    const float lx = 255 * std::sin(az) * std::cos(alt),
+                ly = 255 * std::cos(az) * std::cos(alt),
+                lz = 255 * std::sin(alt);
+    bytes_t shade(width * height);
+    uint8_t *out = shade.data();
+    stencil(dem, width, height, scale_x, scale_y, z_factor,
+        [=](size_t first, const float* gx, const float* gy, long n) {
+            #pragma omp simd
+            for (long x = 0; x < n; x++) {
+                float v = (lz - gx[x] * lx - gy[x] * ly) /
+                          std::sqrt(gx[x] * gx[x] + gy[x] * gy[x] + 1) + 0.5f;
+                out[first + x] = v > 0 ? uint8_t(std::min(v, 255.0f)) : 0;
+            }
+        });
+    return shade;
+}
+
+bytes_t hillshade(const gdal& map, size_t band, double azimuth,
+        double altitude, float z_factor) {
+    return hillshade(map.bands[band], map.get_width(), map.get_height(),
+        map.get_scale_x(), map.get_scale_y(), azimuth, altitude, z_factor);
+}
+
+} // namespace gdalwrap
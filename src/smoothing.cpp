@@ -0,0 +1,266 @@
+/*
+ * smoothing.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <iostream>         // cerr,endl
+#include <algorithm>
+#include "gdalwrap/smoothing.hpp"
+
+namespace gdalwrap {
+
+typedef std::vector<double> values_t;
+
+/** box mean of the (2 r + 1)^2 window around each cell, clipped, in place
+ *
+ * Separable running sums in double: rows in parallel, then blocks of
+ * columns in parallel (row by row, contiguous).
+ */
+static void box_mean(values_t& v, long w, long h, long r) {
+    values_t tmp(v.size());
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < h; y++) {
+        const double *src = v.data() + y * w;
+        double *dst = tmp.data() + y * w;
+        double sum = 0;
+        for (long x = 0; x < std::min(r, w); x++)
+            sum += src[x];
+        for (long x = 0; x < w; x++) {
+            if (x + r < w)
+                sum += src[x + r];
+            if (x - r - 1 >= 0)
+                sum -= src[x - r - 1];
+            dst[x] = sum / (std::min(x + r, w - 1) - std::max(x - r, 0L) + 1);
+        }
+    }
+    const long block = 256;
+    #pragma omp parallel for schedule(static)
+    for (long c0 = 0; c0 < w; c0 += block) {
+        long n = std::min(block, w - c0);
+        values_t sum(n, 0);
+        for (long y = 0; y < std::min(r, h); y++)
+            for (long c = 0; c < n; c++)
+                sum[c] += tmp[c0 + c + y * w];
+        for (long y = 0; y < h; y++) {
+            const double *add = (y + r < h) ? &tmp[c0 + (y + r) * w] : NULL;
+            const double *sub = (y - r - 1 >= 0) ?
+                &tmp[c0 + (y - r - 1) * w] : NULL;
+            double count = std::min(y + r, h - 1) - std::max(y - r, 0L) + 1;
+            for (long c = 0; c < n; c++) {
+                if (add)
+                    sum[c] += add[c];
+                if (sub)
+                    sum[c] -= sub[c];
+                v[c0 + c + y * w] = sum[c] / count;
+            }
+        }
+    }
+}
+
+static double band_mean(const raster& band) {
+    double mean = 0;
+    for (float v : band)
+        mean += v;
+    return band.empty() ? 0 : mean / band.size();
+}
+
+raster guided_filter(const raster& band, const raster& guide,
+        size_t width, size_t height, size_t radius, double eps) {
+    const long r = radius, w = width, h = height, size = w * h;
+    // centered values in double: no cancellation on E[xy] - E[x] E[y]
+    const double oi = band_mean(guide), op = band_mean(band);
+    values_t mi(size), mp(size), mii(size), mip(size);
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < size; i++) {
+        double vi = guide[i] - oi, vp = band[i] - op;
+        mi[i] = vi;
+        mp[i] = vp;
+        mii[i] = vi * vi;
+        mip[i] = vi * vp;
+    }
+    box_mean(mi, w, h, r);
+    box_mean(mp, w, h, r);
+    box_mean(mii, w, h, r);
+    box_mean(mip, w, h, r);
+    // linear coefficients of each window (a in mii, b in mip)
+    values_t& a = mii;
+    values_t& b = mip;
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < size; i++) {
+        double vi = mii[i] - mi[i] * mi[i];
+        double cov = mip[i] - mi[i] * mp[i];
+        a[i] = cov / (std::max(vi, 0.0) + eps);
+        b[i] = mp[i] - a[i] * mi[i];
+    }
+    // average the coefficients of the windows covering each cell
+    box_mean(a, w, h, r);
+    box_mean(b, w, h, r);
+    raster result(size);
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < size; i++)
+        result[i] = a[i] * (guide[i] - oi) + b[i] + op;
+    return result;
+}
+
+/** blur a (nx, ny, nz) grid of (value, weight) with [1 2 1] / 4 along
+ * each axis, stride s between neighbours along the axis of length n */
+static void blur_axis(std::vector<float>& grid, size_t nx, size_t ny,
+        size_t nz, int axis) {
+    size_t n = axis == 0 ? nx : axis == 1 ? ny : nz;
+    size_t s = axis == 0 ? 2 : axis == 1 ? 2 * nx : 2 * nx * ny;
+    size_t lines = nx * ny * nz / n;
+    #pragma omp parallel
+    {
+        std::vector<float> line(2 * n);
+        #pragma omp for schedule(static)
+        for (long l = 0; l < long(lines); l++) {
+            // first cell of the line l
+            size_t start;
+            if (axis == 0)
+                start = 2 * (l * nx);
+            else if (axis == 1)
+                start = 2 * ((l % nx) + (l / nx) * nx * ny);
+            else
+                start = 2 * l;
+            for (size_t k = 0; k < n; k++) {
+                line[2 * k]     = grid[start + k * s];
+                line[2 * k + 1] = grid[start + k * s + 1];
+            }
+            for (size_t k = 0; k < n; k++) {
+                for (int c = 0; c < 2; c++) {
+                    float prev = k > 0 ? line[2 * (k - 1) + c] : 0;
+                    float next = k < n - 1 ? line[2 * (k + 1) + c] : 0;
+                    grid[start + k * s + c] =
+                        (prev + 2 * line[2 * k + c] + next) / 4;
+                }
+            }
+        }
+    }
+}
+
+/* grid budget, in (value, weight) cells: 2^26 cells, 512 MB */
+static const double max_grid_cells = double(1 << 26);
+
+raster bilateral_filter(const raster& band, size_t width, size_t height,
+        double sigma_space, double sigma_range, float no_data) {
+    auto ignored = [no_data](float v) {
+        return std::isnan(v) or v == no_data;
+    };
+    float zmin = std::numeric_limits<float>::max(), zmax = -zmin;
+    for (float v : band)
+        if (!ignored(v)) {
+            zmin = std::min(zmin, v);
+            zmax = std::max(zmax, v);
+        }
+    raster result(band);
+    if (zmin > zmax or sigma_space <= 0 or sigma_range <= 0)
+        return result;
+    // grid with one cell margin, so that trilinear weights stay inside;
+    // over the budget, the range (then the space) sampling is coarsened
+    auto cells = [](double length, double sigma) {
+        return std::floor(length / sigma) + 3;
+    };
+    double nxy = cells(width - 1, sigma_space) * cells(height - 1,
+        sigma_space);
+    double range = zmax - zmin;
+    if (nxy * cells(range, sigma_range) > max_grid_cells) {
+        double nz = std::max(3.0, std::floor(max_grid_cells / nxy));
+        sigma_range = std::max(sigma_range,
+            range / std::max(nz - 3, 1.0) * 1.0001);
+        double nxy_max = max_grid_cells / 3;
+        while (nxy > nxy_max) {
+            sigma_space *= 1.25;
+            nxy = cells(width - 1, sigma_space) * cells(height - 1,
+                sigma_space);
+        }
+        std::cerr<<"[warn]["<< __func__ <<"] grid over budget, effective "
+            "sigma_space "<<sigma_space<<" px, sigma_range "<<sigma_range
+            <<std::endl;
+    }
+    size_t nx = cells(width - 1, sigma_space);
+    size_t ny = cells(height - 1, sigma_space);
+    size_t nz = cells(range, sigma_range);
+    std::vector<float> grid(2 * nx * ny * nz, 0);
+    auto coords = [&](size_t x, size_t y, float v, float& gx, float& gy,
+            float& gz) {
+        gx = x / sigma_space + 1;
+        gy = y / sigma_space + 1;
+        gz = (v - zmin) / sigma_range + 1;
+    };
+    // splat (nearest grid cell, as in Paris & Durand), by grid rows in
+    // parallel: the raster rows of a grid row are contiguous
+    std::vector<size_t> first(ny + 1, height);
+    for (size_t y = height; y-- > 0;)
+        first[size_t(y / sigma_space + 1.5)] = y;
+    for (size_t g = ny; g-- > 0;)
+        first[g] = std::min(first[g], first[g + 1]);
+    #pragma omp parallel for schedule(dynamic)
+    for (long g = 0; g < long(ny); g++) {
+        for (size_t y = first[g]; y < first[g + 1]; y++) {
+            for (size_t x = 0; x < width; x++) {
+                float v = band[x + y * width];
+                if (ignored(v))
+                    continue;
+                float gx, gy, gz;
+                coords(x, y, v, gx, gy, gz);
+                size_t i = 2 * (size_t(gx + 0.5) + g * nx +
+                                size_t(gz + 0.5) * nx * ny);
+                grid[i]     += v;
+                grid[i + 1] += 1;
+            }
+        }
+    }
+    for (int axis = 0; axis < 3; axis++)
+        blur_axis(grid, nx, ny, nz, axis);
+    // slice: trilinear interpolation of (value, weight)
+    long w = width, h = height;
+    #pragma omp parallel for schedule(static)
+    for (long y = 0; y < h; y++) {
+        for (long x = 0; x < w; x++) {
+            float v = band[x + y * w];
+            if (ignored(v))
+                continue;
+            float gx, gy, gz;
+            coords(x, y, v, gx, gy, gz);
+            size_t x0 = gx, y0 = gy, z0 = gz;
+            float fx = gx - x0, fy = gy - y0, fz = gz - z0;
+            double sum = 0, weight = 0;
+            for (int k = 0; k < 8; k++) {
+                int ix = k & 1, iy = (k >> 1) & 1, iz = k >> 2;
+                float c = (ix ? fx : 1 - fx) * (iy ? fy : 1 - fy) *
+                          (iz ? fz : 1 - fz);
+                size_t g = 2 * ((x0 + ix) + (y0 + iy) * nx +
+                                (z0 + iz) * nx * ny);
+                sum    += c * grid[g];
+                weight += c * grid[g + 1];
+            }
+            if (weight > 0)
+                result[x + y * w] = sum / weight;
+        }
+    }
+    return result;
+}
+
+raster guided_filter(const gdal& map, size_t band, double radius,
+        double eps) {
+    size_t r = std::round(radius / std::abs(map.get_scale_x()));
+    return guided_filter(map.bands[band], map.bands[band], map.get_width(),
+        map.get_height(), r, eps);
+}
+
+raster bilateral_filter(const gdal& map, size_t band, double sigma_space,
+        double sigma_range, float no_data) {
+    return bilateral_filter(map.bands[band], map.get_width(),
+        map.get_height(), sigma_space / std::abs(map.get_scale_x()),
+        sigma_range, no_data);
+}
+
+} // namespace gdalwrap
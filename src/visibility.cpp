@@ -0,0 +1,108 @@
+/*
+ * visibility.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "gdalwrap/visibility.hpp"
+#include "gdalwrap/atomic.hpp"
+
+namespace gdalwrap {
+
+bool line_of_sight(const gdal& map, size_t band,
+        const point_xy_t& from, double from_height,
+        const point_xy_t& to, double to_height, bool custom) {
+    const raster& elevation = map.bands[band];
+    size_t width = map.get_width(), height = map.get_height();
+    point_xy_t a = custom ? map.point_custom2pix(from[0], from[1])
+                          : map.point_utm2pix(from[0], from[1]);
+    point_xy_t b = custom ? map.point_custom2pix(to[0], to[1])
+                          : map.point_utm2pix(to[0], to[1]);
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    float za = bilinear(elevation, width, height, a[0], a[1], nan);
+    float zb = bilinear(elevation, width, height, b[0], b[1], nan);
+    if (std::isnan(za) or std::isnan(zb))
+        return false; // outside the map
+    double z0 = za + from_height, z1 = zb + to_height;
+    size_t n = std::ceil(std::max(std::abs(b[0] - a[0]),
+                                  std::abs(b[1] - a[1])));
+    for (size_t k = 1; k < n; k++) {
+        double t = double(k) / n;
+        float z = bilinear(elevation, width, height,
+            a[0] + t * (b[0] - a[0]), a[1] + t * (b[1] - a[1]), nan);
+        if (z > z0 + t * (z1 - z0))
+            return false;
+    }
+    return true;
+}
+
+raster viewshed(const gdal& map, size_t band,
+        const point_xy_t& observer, double observer_height,
+        double target_height, double max_distance, bool custom) {
+    const raster& elevation = map.bands[band];
+    long width = map.get_width(), height = map.get_height();
+    raster visible(width * height, 0);
+    point_xy_t o = custom ? map.point_custom2pix(observer[0], observer[1])
+                          : map.point_utm2pix(observer[0], observer[1]);
+    long ox = std::round(o[0]), oy = std::round(o[1]);
+    if (ox < 0 or oy < 0 or ox >= width or oy >= height)
+        return visible;
+    double sx = std::abs(map.get_scale_x()), sy = std::abs(map.get_scale_y());
+    double z0 = elevation[ox + oy * width] + observer_height;
+    visible[ox + oy * width] = 1;
+
+    // area of interest, clipped to the raster
+    long rx = std::isinf(max_distance) ? width  : std::ceil(max_distance / sx),
+         ry = std::isinf(max_distance) ? height : std::ceil(max_distance / sy);
+    long x0 = std::max(0L, ox - rx), x1 = std::min(width  - 1, ox + rx),
+         y0 = std::max(0L, oy - ry), y1 = std::min(height - 1, oy + ry);
+    // perimeter cells, each one is the end of a ray
+    std::vector<std::pair<long, long>> ends;
+    for (long x = x0; x <= x1; x++) {
+        ends.push_back(std::make_pair(x, y0));
+        if (y1 != y0)
+            ends.push_back(std::make_pair(x, y1));
+    }
+    for (long y = y0 + 1; y < y1; y++) {
+        ends.push_back(std::make_pair(x0, y));
+        if (x1 != x0)
+            ends.push_back(std::make_pair(x1, y));
+    }
+    double max_d2 = max_distance * max_distance;
+
+    #pragma omp parallel for schedule(dynamic, 16)
+    for (long e = 0; e < long(ends.size()); e++) {
+        long dx = ends[e].first - ox, dy = ends[e].second - oy;
+        long n = std::max(std::abs(dx), std::abs(dy));
+        double max_slope = -std::numeric_limits<double>::infinity();
+        for (long k = 1; k <= n; k++) {
+            double fx = ox + double(dx) * k / n, fy = oy + double(dy) * k / n;
+            double mx = (fx - ox) * sx, my = (fy - oy) * sy;
+            double d2 = mx * mx + my * my;
+            if (d2 > max_d2)
+                break;
+            double d = std::sqrt(d2);
+            // interpolate between the 2 cells along the minor axis
+            double z = bilinear(elevation, width, height, fx, fy);
+            double slope = (z - z0) / d;
+            double target = (z + target_height - z0) / d;
+            if (target >= max_slope) {
+                long cx = std::round(fx), cy = std::round(fy);
+                // many rays share cells near the observer, all write 1
+                atomic_store(&visible[cx + cy * width], 1.0f);
+            }
+            max_slope = std::max(max_slope, slope);
+        }
+    }
+    return visible;
+}
+
+} // namespace gdalwrap
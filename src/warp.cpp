@@ -0,0 +1,105 @@
+/*
+ * warp.cpp
+ *
+ * C++11 GDAL wrapper
+ *
+ * author:  Pierrick Koch <pierrick.koch@laas.fr>
+ * created: 2026-10-18
+ * license: BSD
+ */
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "gdalwrap/warp.hpp"
+
+namespace gdalwrap {
+
+transform_t heading_transform(double x, double y, double heading,
+        double resolution, size_t width, size_t height) {
+    double c = resolution * std::cos(heading),
+           s = resolution * std::sin(heading);
+    transform_t t;
+    t[1] = c;   // column: forward
+    t[4] = s;
+    t[2] = s;   // row: right
+    t[5] = -c;
+    // the origin is the center of the first cell
+    double cx = (width - 1) / 2.0, cy = (height - 1) / 2.0;
+    t[0] = x - (cx * t[1] + cy * t[2]);
+    t[3] = y - (cx * t[4] + cy * t[5]);
+    return t;
+}
+
+gdal warp(const gdal& map, const transform_t& transform,
+        size_t width, size_t height, float no_data) {
+    const transform_t& src = map.get_transform();
+    // inverse of the source transform (linear part)
+    double det = src[1] * src[5] - src[2] * src[4];
+    if (det == 0)
+        throw std::invalid_argument("[gdal] source transform not invertible");
+    double i1 =  src[5] / det, i2 = -src[2] / det,
+           i4 = -src[4] / det, i5 =  src[1] / det;
+    // destination pixel (P, L) -> source pixel (u, v), with cell centers
+    // at integers in both (the transform origin is the center of the first
+    // cell, see gdal::point_pix2utm, not its corner as in GDAL):
+    // u = a0 + P * a1 + L * a2, v = b0 + P * b1 + L * b2
+    double a1 = i1 * transform[1] + i2 * transform[4],
+           a2 = i1 * transform[2] + i2 * transform[5],
+           b1 = i4 * transform[1] + i5 * transform[4],
+           b2 = i4 * transform[2] + i5 * transform[5];
+    double dx = transform[0] - src[0], dy = transform[3] - src[3];
+    double a0 = i1 * dx + i2 * dy,
+           b0 = i4 * dx + i5 * dy;
+
+    gdal result;
+    result.copy_meta(map, width, height);
+    result.set_transform(transform);
+    long sw = map.get_width(), sh = map.get_height();
+    size_t nband = map.bands.size();
+    #pragma omp parallel
+    {
+        // per row: index of the top left source cell, and the 2 fractions
+        std::vector<long>  index(width);
+        std::vector<float> fxs(width), fys(width);
+        #pragma omp for schedule(static)
+        for (long row = 0; row < long(height); row++) {
+            double u = a0 + row * a2, v = b0 + row * b2;
+            for (size_t col = 0; col < width; col++, u += a1, v += b1) {
+                if ( !(u > -0.5 and v > -0.5 and u < sw - 0.5 and
+                       v < sh - 0.5) ) {
+                    index[col] = -1;
+                    continue;
+                }
+                // clamp to the border cells
+                double cu = std::min(std::max(u, 0.0), sw - 1.0),
+                       cv = std::min(std::max(v, 0.0), sh - 1.0);
+                long x0 = std::min(long(cu), sw - 2 < 0 ? 0 : sw - 2),
+                     y0 = std::min(long(cv), sh - 2 < 0 ? 0 : sh - 2);
+                index[col] = x0 + y0 * sw;
+                fxs[col] = (sw > 1) ? cu - x0 : 0;
+                fys[col] = (sh > 1) ? cv - y0 : 0;
+            }
+            long ox = (sw > 1) ? 1 : 0, oy = (sh > 1) ? sw : 0;
+            for (size_t band = 0; band < nband; band++) {
+                const float *in = map.bands[band].data();
+                float *out = result.bands[band].data() + row * width;
+                for (size_t col = 0; col < width; col++) {
+                    long i = index[col];
+                    if (i < 0) {
+                        out[col] = no_data;
+                        continue;
+                    }
+                    float fx = fxs[col], fy = fys[col];
+                    float top = in[i] + fx * (in[i + ox] - in[i]);
+                    float bot = in[i + oy] +
+                                fx * (in[i + oy + ox] - in[i + oy]);
+                    out[col] = top + fy * (bot - top);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace gdalwrap
@@ -0,0 +1,111 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <queue>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <gdalwrap/astar.hpp>
+
+// 8-connected Dijkstra, same move costs as the planner
+float dijkstra(const gdalwrap::gdal& map, size_t s, size_t e) {
+    const gdalwrap::raster& c = map.bands[0];
+    long w = map.get_width(), h = map.get_height();
+    double hx = std::abs(map.get_scale_x()), hy = std::abs(map.get_scale_y());
+    std::vector<float> g(c.size(), INFINITY);
+    typedef std::pair<float, long> item_t;
+    std::priority_queue<item_t, std::vector<item_t>,
+        std::greater<item_t>> open;
+    g[s] = 0;
+    open.push(item_t(0, s));
+    while (!open.empty()) {
+        item_t it = open.top();
+        open.pop();
+        long i = it.second, x = i % w, y = i / w;
+        if (it.first > g[i])
+            continue;
+        for (long dy = -1; dy <= 1; dy++)
+            for (long dx = -1; dx <= 1; dx++) {
+                long nx = x + dx, ny = y + dy, n = nx + ny * w;
+                if ((!dx and !dy) or nx < 0 or ny < 0 or nx >= w or ny >= h
+                        or !(c[n] > 0))
+                    continue;
+                if (dx and dy and !(c[nx + y * w] > 0 and c[x + ny * w] > 0))
+                    continue;
+                float v = g[i] + std::hypot(dx * hx, dy * hy) *
+                    (c[i] + c[n]) / 2;
+                if (v < g[n]) {
+                    g[n] = v;
+                    open.push(item_t(v, n));
+                }
+            }
+    }
+    return g[e];
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap astar test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 1, 1);
+    map.set_size(1, 30, 20, 1);
+    gdalwrap::astar planner;
+
+    // straight line
+    gdalwrap::points_xy_t path = planner.plan(map, 0, {{2, 5}}, {{12, 5}});
+    assert( path.size() == 11 );
+    assert( std::abs(planner.get_cost() - 10) < 1e-5 );
+
+    // wall with a gap at the bottom
+    for (size_t y = 0; y < 18; y++)
+        map.bands[0][15 + y * 30] = 0;
+    path = planner.plan(map, 0, {{5, 5}}, {{25, 5}});
+    assert( !path.empty() );
+    for (const auto& p : path)
+        assert( map.bands[0][map.index_utm(p[0], p[1])] > 0 );
+    float cost = planner.get_cost();
+
+    // any angle is never longer, and workspace reuse gives the same result
+    gdalwrap::points_xy_t theta = planner.plan(map, 0, {{5, 5}}, {{25, 5}},
+        false, true);
+    assert( theta.size() < path.size() );
+    assert( planner.get_cost() <= cost + 1e-4 );
+    planner.plan(map, 0, {{5, 5}}, {{25, 5}});
+    assert( planner.get_cost() == cost );
+
+    // closed wall
+    map.bands[0][15 + 18 * 30] = map.bands[0][15 + 19 * 30] = 0;
+    path = planner.plan(map, 0, {{5, 5}}, {{25, 5}});
+    assert( path.empty() );
+    assert( std::isinf(planner.get_cost()) );
+
+    // anisotropic pixels, random obstacles: A* is optimal,
+    // Theta* is never worse
+    gdalwrap::gdal aniso;
+    aniso.set_transform(0, 0, 1, 4);
+    aniso.set_size(1, 40, 30, 1);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    for (auto& c : aniso.bands[0])
+        c = uniform(rng) < 0.25 ? 0 : 1;
+    for (int k = 0; k < 300; k++) {
+        size_t s = rng() % aniso.bands[0].size(),
+               e = rng() % aniso.bands[0].size();
+        if (!(aniso.bands[0][s] > 0) or !(aniso.bands[0][e] > 0))
+            continue;
+        gdalwrap::point_xy_t ps = aniso.point_pix2utm(s % 40, s / 40),
+                             pe = aniso.point_pix2utm(e % 40, e / 40);
+        float expected = dijkstra(aniso, s, e);
+        path = planner.plan(aniso, 0, ps, pe);
+        if (std::isinf(expected)) {
+            assert( path.empty() );
+            continue;
+        }
+        assert( std::abs(planner.get_cost() - expected) <= 1e-3 * expected );
+        planner.plan(aniso, 0, ps, pe, false, true);
+        assert( planner.get_cost() <= expected * (1 + 1e-5f) );
+    }
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,52 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <gdalwrap/atomic.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap atomic test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 1, 1);
+    map.set_size(4, 10, 10, 0);
+    gdalwrap::concurrent_writer writer(map);
+    const size_t none = std::numeric_limits<size_t>::max();
+
+    // all threads hammer the same cell
+    const long n = 100000;
+    map.bands[2][42] = std::numeric_limits<float>::max();
+    #pragma omp parallel for schedule(static, 1)
+    for (long i = 0; i < n; i++) {
+        writer.add(0, 42, 1);
+        writer.max(1, 42, i);
+        writer.min(2, 42, i);
+        // increment by compare and swap
+        float old;
+        do {
+            old = writer.load(3, 42);
+        } while ( !writer.cas(3, 42, old, old + 1) );
+    }
+    assert( map.bands[0][42] == n );
+    assert( map.bands[1][42] == n - 1 );
+    assert( map.bands[2][42] == 0 );
+    assert( map.bands[3][42] == n );
+    for (size_t i = 0; i < 100; i++)
+        if (i != 42)
+            assert( map.bands[0][i] == 0 and map.bands[3][i] == 0 );
+
+    // out of bounds: no write, load is NaN
+    writer.add(0, none, 1);
+    writer.store(0, 100, 1);
+    writer.add_utm(0, -5, 3, 1);
+    assert( !writer.cas(0, 100, 0, 1) );
+    assert( std::isnan(writer.load(0, none)) );
+    assert( std::isnan(writer.load(0, 100)) );
+    assert( writer.load(0, 42) == n );
+    writer.add_utm(0, 2, 3, 1);
+    assert( map.bands[0][2 + 3 * 10] == 1 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,60 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <gdalwrap/change.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap change test..." << std::endl;
+
+    // before: 20 x 20 at 1 m, after: 20 x 20 at 1 m shifted by (10, -5) m
+    gdalwrap::gdal before, after;
+    before.set_size(1, 20, 20);
+    before.set_transform(100, 200, 1, -1);
+    after.set_size(1, 20, 20);
+    after.set_transform(110, 195, 1, -1);
+    for (size_t y = 0; y < 20; y++)
+        for (size_t x = 0; x < 20; x++) {
+            before.bands[0][x + y * 20] = x + 10.0 * y;
+            // same terrain, seen from the after grid
+            after.bands[0][x + y * 20] = (x + 10) + 10.0 * (y + 5);
+        }
+    // a new 3 x 2 mound and a 1 cell pit in the overlap
+    for (size_t y = 2; y < 4; y++)
+        for (size_t x = 1; x < 4; x++)
+            after.bands[0][x + y * 20] += 2;
+    after.bands[0][7 + 10 * 20] -= 0.5;
+    // a no-data cell is not a change
+    after.bands[0][8 + 12 * 20] = std::numeric_limits<float>::quiet_NaN();
+
+    gdalwrap::labels_t labels;
+    gdalwrap::components_t components;
+    gdalwrap::gdal diff = gdalwrap::change_detection(before, 0, after, 0,
+        0.25, labels, components);
+    // overlap: x in [110, 120[, y in ]180, 195]
+    assert( diff.get_width() == 10 );
+    assert( diff.get_height() == 15 );
+    assert( diff.get_utm_pose_x() == 110 );
+    assert( diff.get_utm_pose_y() == 195 );
+    const gdalwrap::raster& d = diff.get_band(gdalwrap::change_difference);
+    const gdalwrap::raster& m = diff.get_band(gdalwrap::change_mask);
+    assert( d[0] == 0 );
+    assert( d[1 + 2 * 10] == 2 );
+    assert( d[7 + 10 * 10] == -0.5 );
+    assert( std::isnan(d[8 + 12 * 10]) );
+    assert( m[8 + 12 * 10] == 0 );
+    assert( components.size() == 2 );
+    assert( components[0].area == 6 );
+    assert( components[1].area == 1 );
+    assert( labels[7 + 10 * 10] == 2 );
+
+    // no overlap
+    after.set_transform(500, 500, 1, -1);
+    diff = gdalwrap::change_detection(before, 0, after, 0, 0.25, labels,
+        components);
+    assert( diff.get_width() == 0 and components.empty() );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
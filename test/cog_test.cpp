@@ -0,0 +1,81 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib> // std::rand
+#include <string>
+#include <iostream>
+#include <gdal_priv.h>
+#include <gdalwrap/gdal.hpp>
+
+static const size_t nsx = 600;
+static const size_t nsy = 300;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap cog test..." << std::endl;
+
+    gdalwrap::gdal geotif;
+    geotif.set_size(2, nsx, nsy);
+    geotif.set_utm(31);
+    geotif.set_transform(370000, 4800000, 0.5, -0.5);
+    geotif.names[0] = "Z_MAX";
+    geotif.names[1] = "N_POINTS";
+    for (auto& band : geotif.bands)
+        for (auto& v : band)
+            v = std::rand() % 1000;
+
+    for (bool compress : {false, true}) {
+        std::string name = std::string(std::tmpnam(nullptr)) + ".tif";
+        geotif.save_cog(name, "AVERAGE", compress, 256);
+
+        // same content once loaded back
+        // (GDAL may add metadata such as AREA_OR_POINT)
+        gdalwrap::gdal copy(name);
+        assert( copy.get_width() == nsx and copy.get_height() == nsy );
+        assert( copy.get_transform() == geotif.get_transform() );
+        assert( copy.get_utm_zone() == 31 );
+        assert( copy.names == geotif.names );
+        assert( copy.bands == geotif.bands );
+
+        // tiled, with overviews until the raster fits in one tile
+        GDALDataset *dataset = (GDALDataset *) GDALOpen( name.c_str(),
+            GA_ReadOnly );
+        assert( dataset != NULL );
+        // COG layout (ghost area) with the COG driver, GDAL >= 3.1
+        if (GetGDALDriverManager()->GetDriverByName("COG") != NULL) {
+            const char *layout = dataset->GetMetadataItem("LAYOUT",
+                "IMAGE_STRUCTURE");
+            assert( layout != NULL and std::string(layout) == "COG" );
+        }
+        GDALRasterBand *band = dataset->GetRasterBand(1);
+        int bx, by;
+        band->GetBlockSize(&bx, &by);
+        assert( bx == 256 and by == 256 );
+        assert( band->GetOverviewCount() == 2 );
+        GDALRasterBand *smallest = band->GetOverview(1);
+        assert( smallest->GetXSize() == 150 and smallest->GetYSize() == 75 );
+        // the first overview is the mean of 2 x 2 blocks
+        float v;
+        assert( band->GetOverview(0)->RasterIO(GF_Read, 0, 0, 1, 1, &v,
+            1, 1, GDT_Float32, 0, 0) == CE_None );
+        const gdalwrap::raster& z = geotif.bands[0];
+        assert( std::abs(v - (z[0] + z[1] + z[nsx] + z[nsx + 1]) / 4) < 1e-3 );
+        GDALClose( (GDALDatasetH) dataset );
+        std::remove( name.c_str() );
+    }
+
+    // fits in one tile: no overview
+    gdalwrap::gdal tile;
+    tile.set_size(1, 200, 100);
+    std::string name = std::string(std::tmpnam(nullptr)) + ".tif";
+    tile.save_cog(name);
+    GDALDataset *dataset = (GDALDataset *) GDALOpen( name.c_str(),
+        GA_ReadOnly );
+    assert( dataset != NULL );
+    assert( dataset->GetRasterBand(1)->GetOverviewCount() == 0 );
+    GDALClose( (GDALDatasetH) dataset );
+    std::remove( name.c_str() );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
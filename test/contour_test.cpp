@@ -0,0 +1,183 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+#include <ogrsf_frmts.h>
+#include <gdalwrap/contour.hpp>
+
+static const size_t nsx = 21;
+static const size_t nsy = 21;
+
+// square edge of a point on a 2x2 grid: 0 top, 1 right, 2 bottom, 3 left
+static int square_edge(const gdalwrap::point_xy_t& p) {
+    if (p[1] == 0) return 0;
+    if (p[0] == 1) return 1;
+    if (p[1] == 1) return 2;
+    assert( p[0] == 0 );
+    return 3;
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap contour test..." << std::endl;
+
+    // case table: the 16 squares of 0 / 1 corners at level 0.5, the line
+    // crosses the edges between a low and a high corner, at their middle
+    // (corners v0 (0, 0), v1 (1, 0), v2 (1, 1), v3 (0, 1))
+    const int corner[4][2] = { {0, 1}, {1, 2}, {3, 2}, {0, 3} }; // edges
+    for (int c = 0; c < 16; c++) {
+        float v[4] = { float(c & 1), float(c >> 1 & 1), float(c >> 2 & 1),
+                       float(c >> 3 & 1) };
+        gdalwrap::raster band = { v[0], v[1], v[3], v[2] };
+        gdalwrap::contours_t lines = gdalwrap::contours(band, 2, 2, {0.5});
+        int crossed = 0;
+        for (int e = 0; e < 4; e++)
+            crossed += v[corner[e][0]] != v[corner[e][1]];
+        size_t npoints = 0;
+        for (const auto& line : lines) {
+            assert( line.level == 0.5f and !line.closed );
+            assert( line.points.size() == 2 );
+            for (const auto& p : line.points) {
+                int e = square_edge(p);
+                assert( v[corner[e][0]] != v[corner[e][1]] );
+                assert( std::abs(p[0] - 0.5) == 0.5 or p[0] == 0.5 );
+                assert( std::abs(p[1] - 0.5) == 0.5 or p[1] == 0.5 );
+            }
+            npoints += line.points.size();
+        }
+        assert( int(npoints) == crossed );
+        assert( lines.size() == size_t(crossed / 2) );
+    }
+
+    // saddles: the high corners are connected if the mean is high
+    gdalwrap::raster saddle = { 1, 0, 0, 1 }; // case 5: v0, v2 high
+    gdalwrap::contours_t lines = gdalwrap::contours(saddle, 2, 2, {0.5});
+    assert( lines.size() == 2 );
+    for (const auto& line : lines) {
+        int a = square_edge(line.points[0]), b = square_edge(line.points[1]);
+        // cut the low corners v1 (top, right) and v3 (bottom, left)
+        assert( (a ^ b) == 1 and std::min(a, b) % 2 == 0 );
+    }
+    lines = gdalwrap::contours(saddle, 2, 2, {0.6});
+    assert( lines.size() == 2 );
+    for (const auto& line : lines) {
+        int a = square_edge(line.points[0]), b = square_edge(line.points[1]);
+        // cut the high corners v0 (left, top) and v2 (right, bottom)
+        assert( (a == 3 and b == 0) or (a == 0 and b == 3) or
+                (a == 1 and b == 2) or (a == 2 and b == 1) );
+        // linear interpolation on the edges: 0.6 is at 0.4 from the 1
+        for (const auto& p : line.points)
+            assert( std::abs(p[0] - 0.4) < 1e-6 or
+                    std::abs(p[1] - 0.4) < 1e-6 or
+                    std::abs(p[0] - 0.6) < 1e-6 or
+                    std::abs(p[1] - 0.6) < 1e-6 );
+    }
+    saddle = { 0, 1, 1, 0 }; // case 10: v1, v3 high, connected at 0.5
+    lines = gdalwrap::contours(saddle, 2, 2, {0.5});
+    assert( lines.size() == 2 );
+    for (const auto& line : lines) {
+        int a = square_edge(line.points[0]), b = square_edge(line.points[1]);
+        assert( (a == 3 and b == 0) or (a == 0 and b == 3) or
+                (a == 1 and b == 2) or (a == 2 and b == 1) );
+    }
+
+    // plane z = x: one open vertical line per level, stitched over the rows
+    gdalwrap::raster plane(nsx * nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            plane[x + y * nsx] = x;
+    lines = gdalwrap::contours(plane, nsx, nsy, {3.5, 10.25});
+    assert( lines.size() == 2 );
+    for (const auto& line : lines) {
+        assert( !line.closed and line.points.size() == nsy );
+        for (size_t k = 0; k < nsy; k++)
+            assert( line.points[k][0] == line.level );
+        double y0 = line.points.front()[1], y1 = line.points.back()[1];
+        assert( std::min(y0, y1) == 0 and std::max(y0, y1) == nsy - 1 );
+    }
+
+    // no-data cut the line in 2 open lines
+    plane[3 + 10 * nsx] = std::numeric_limits<float>::quiet_NaN();
+    lines = gdalwrap::contours(plane, nsx, nsy, {3.5});
+    assert( lines.size() == 2 );
+    assert( lines[0].points.size() + lines[1].points.size() == nsy - 1 );
+    plane[3 + 10 * nsx] = -1;
+    lines = gdalwrap::contours(plane, nsx, nsy, {3.5}, -1);
+    assert( lines.size() == 2 );
+
+    // cone z = -r: one closed line per level, near the circle of radius l
+    gdalwrap::raster cone(nsx * nsy);
+    double cx = (nsx - 1) / 2.0, cy = (nsy - 1) / 2.0;
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            cone[x + y * nsx] = -std::hypot(x - cx, y - cy);
+    lines = gdalwrap::contours(cone, nsx, nsy, {-3, -7.5});
+    assert( lines.size() == 2 );
+    for (const auto& line : lines) {
+        assert( line.closed and line.points.size() > 8 );
+        assert( line.points.front() == line.points.back() );
+        for (const auto& p : line.points)
+            assert( std::abs(std::hypot(p[0] - cx, p[1] - cy) + line.level)
+                    < 0.1 );
+    }
+
+    // gdal: lines in UTM
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    map.bands[0] = plane;
+    map.bands[0][3 + 10 * nsx] = 3;
+    lines = gdalwrap::contours(map, 0, {3.5});
+    assert( lines.size() == 1 and lines[0].points.size() == nsy );
+    for (const auto& p : lines[0].points)
+        assert( p[0] == 101.75 and p[1] <= 200 and p[1] >= 190 );
+
+    // written as line strings with a LEVEL field, and read back
+    lines = gdalwrap::contours(map, 0, {3.5, 10.25});
+    std::string name = std::string(std::tmpnam(nullptr)) + ".geojson";
+    gdalwrap::save_contours(lines, map, name, "GeoJSON");
+    GDALDataset *dataset = (GDALDataset*) GDALOpenEx(name.c_str(),
+        GDAL_OF_VECTOR, NULL, NULL, NULL);
+    assert( dataset != NULL and dataset->GetLayerCount() == 1 );
+    OGRLayer *layer = dataset->GetLayer(0);
+    assert( layer->GetFeatureCount() == 2 );
+    layer->ResetReading();
+    for (const auto& line : lines) {
+        OGRFeature *feature = layer->GetNextFeature();
+        assert( feature != NULL );
+        assert( feature->GetFieldAsDouble("LEVEL") == line.level );
+        OGRGeometry *geometry = feature->GetGeometryRef();
+        assert( wkbFlatten(geometry->getGeometryType()) == wkbLineString );
+        OGRLineString *points = static_cast<OGRLineString*>(geometry);
+        assert( points->getNumPoints() == int(line.points.size()) );
+        for (int k = 0; k < points->getNumPoints(); k++)
+            assert( std::abs(points->getX(k) - line.points[k][0]) < 1e-9 and
+                    std::abs(points->getY(k) - line.points[k][1]) < 1e-9 );
+        OGRFeature::DestroyFeature(feature);
+    }
+    GDALClose( (GDALDatasetH) dataset );
+    std::remove(name.c_str());
+
+    // errors are thrown
+    bool thrown = false;
+    try {
+        gdalwrap::save_contours(lines, map, name, "NoSuchDriver");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert( thrown );
+    thrown = false;
+    try {
+        gdalwrap::save_contours(lines, map, "/no/such/dir/c.geojson",
+            "GeoJSON");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert( thrown );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
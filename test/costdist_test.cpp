@@ -0,0 +1,121 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <queue>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <gdalwrap/costdist.hpp>
+
+static const long nsx = 60;
+static const long nsy = 40;
+
+// Dijkstra on the 4 or 8-connected grid, entering a cell costs its cost
+// times the length of the move (4: upper bound of the fast marching)
+std::vector<double> dijkstra(const gdalwrap::raster& cost, long s,
+        bool eight) {
+    std::vector<double> g(cost.size(), INFINITY);
+    typedef std::pair<double, long> item_t;
+    std::priority_queue<item_t, std::vector<item_t>,
+        std::greater<item_t>> open;
+    g[s] = 0;
+    open.push(item_t(0, s));
+    while (!open.empty()) {
+        item_t it = open.top();
+        open.pop();
+        long i = it.second, x = i % nsx, y = i / nsx;
+        if (it.first > g[i])
+            continue;
+        for (long dy = -1; dy <= 1; dy++)
+            for (long dx = -1; dx <= 1; dx++) {
+                long nx = x + dx, ny = y + dy, n = nx + ny * nsx;
+                if ((!dx and !dy) or (dx and dy and !eight) or nx < 0 or
+                        ny < 0 or nx >= nsx or ny >= nsy or !(cost[n] > 0))
+                    continue;
+                if (dx and dy and !(cost[nx + y * nsx] > 0 and
+                                    cost[x + ny * nsx] > 0))
+                    continue;
+                double v = g[i] + std::hypot(dx, dy) * cost[n];
+                if (v < g[n]) {
+                    g[n] = v;
+                    open.push(item_t(v, n));
+                }
+            }
+    }
+    return g;
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap costdist test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 1, 1);
+    map.set_size(1, nsx, nsy, 1);
+    const long s = 20 + 15 * nsx;
+    gdalwrap::point_xy_t source = map.point_pix2utm(20, 15);
+
+    // uniform cost: exact along the axes, between the euclidean distance
+    // and the 4-connected (manhattan) one elsewhere
+    gdalwrap::gdal field = gdalwrap::cost_distance(map, 0, {source});
+    const gdalwrap::raster& t = field.get_band(gdalwrap::costdist_distance);
+    std::vector<double> d4 = dijkstra(map.bands[0], s, false),
+                        d8 = dijkstra(map.bands[0], s, true);
+    for (long y = 0; y < nsy; y++)
+        for (long x = 0; x < nsx; x++) {
+            long i = x + y * nsx;
+            double euclid = std::hypot(x - 20, y - 15);
+            assert( t[i] >= euclid - 1e-4 and t[i] <= d4[i] + 1e-4 );
+            if (x == 20 or y == 15)
+                assert( std::abs(t[i] - euclid) < 1e-4 );
+            // first order scheme: a few percent from the 8-connected one
+            if (euclid > 8)
+                assert( std::abs(t[i] - d8[i]) < 0.1 * d8[i] );
+        }
+
+    // random costs and obstacles, on a 0.5 m isotropic grid
+    map.set_transform(0, 0, 0.5, -0.5);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    for (auto& c : map.bands[0])
+        c = uniform(rng) < 0.15 ? 0 : 1 + uniform(rng);
+    map.bands[0][s] = 1;
+    source = map.point_pix2utm(20, 15);
+    field = gdalwrap::cost_distance(map, 0, {source});
+    d4 = dijkstra(map.bands[0], s, false);
+    d8 = dijkstra(map.bands[0], s, true);
+    size_t reached = 0;
+    for (long i = 0; i < nsx * nsy; i++) {
+        double fmm = field.bands[0][i];
+        if (std::isinf(d4[i])) {
+            assert( std::isinf(fmm) );
+            continue;
+        }
+        reached++;
+        assert( fmm <= 0.5 * d4[i] * (1 + 1e-5) );
+        assert( fmm >= 0.5 * d8[i] * 0.7 );
+        // back-pointers lead to the source, the distance decreases
+        gdalwrap::points_xy_t path = gdalwrap::trace_back(field,
+            map.point_pix2utm(i % nsx, i / nsx));
+        assert( !path.empty() );
+        assert( map.index_utm(path.back()[0], path.back()[1]) == size_t(s) );
+        for (size_t k = 1; k < path.size(); k++)
+            assert( field.bands[0][map.index_utm(path[k][0], path[k][1])] <
+                    field.bands[0][map.index_utm(path[k - 1][0],
+                                                 path[k - 1][1])] );
+    }
+    assert( reached > size_t(nsx * nsy / 2) );
+
+    // early stop once the goal is reached
+    gdalwrap::point_xy_t goal = map.point_pix2utm(22, 15);
+    gdalwrap::gdal partial = gdalwrap::cost_distance(map, 0, {source},
+        {goal});
+    size_t i = map.index_utm(goal[0], goal[1]);
+    assert( partial.bands[0][i] == field.bands[0][i] );
+    size_t unreached = 0;
+    for (float v : partial.bands[0])
+        unreached += std::isinf(v);
+    assert( unreached > nsx * nsy / 2 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
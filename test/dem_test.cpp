@@ -0,0 +1,40 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdlib> // std::rand
+#include <iostream>
+#include <gdalwrap/dem.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap dem test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_custom_origin(100, 200);
+    map.set_size(0, 4, 3);
+    gdalwrap::init_dem(map);
+    assert( map.bands.size() == 5 );
+
+    // custom (0.6, -1.1) is in the cell (1, 2)
+    gdalwrap::points_xyz_t batch1 = {
+        {{0.6, -1.1, 1.0}}, {{0.6, -1.1, 3.0}}, {{50, 50, 9.0}} };
+    gdalwrap::points_xyz_t batch2 = {
+        {{0.6, -1.1, 2.0}}, {{0.6, -1.1, 6.0}}, {{0.1, -0.1, 4.0}} };
+    assert( gdalwrap::add_points(map, batch1, true) == 2 );
+    assert( gdalwrap::add_points(map, batch2, true) == 3 );
+
+    size_t cell = map.index_custom(0.6, -1.1);
+    assert( cell == 1 + 2 * 4 );
+    // {1, 3, 2, 6}: mean 3, population variance 3.5
+    assert( map.get_band(gdalwrap::dem_n_points)[cell] == 4 );
+    assert( map.get_band(gdalwrap::dem_z_min)[cell] == 1 );
+    assert( map.get_band(gdalwrap::dem_z_max)[cell] == 6 );
+    assert( std::abs(map.get_band(gdalwrap::dem_z_mean)[cell] - 3) < 1e-6 );
+    assert( std::abs(map.get_band(gdalwrap::dem_z_variance)[cell] - 3.5)
+            < 1e-6 );
+    assert( map.get_band(gdalwrap::dem_n_points)[0] == 1 );
+    assert( map.get_band(gdalwrap::dem_z_mean)[0] == 4 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <cstdlib> // std::rand
+#include <iostream>
+#include <gdalwrap/distance.hpp>
+
+static const size_t nsx = 64;
+static const size_t nsy = 48;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap distance test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 0.5, -0.25);
+    map.set_size(1, nsx, nsy);
+    for (size_t i = 0; i < 20; i++)
+        map.bands[0][std::rand() % (nsx * nsy)] = 1;
+
+    gdalwrap::raster dist = gdalwrap::distance_transform(map, 0, 1);
+    assert( dist.size() == nsx * nsy );
+
+    // compare with brute force
+    for (size_t y = 0; y < nsy; y++)
+    for (size_t x = 0; x < nsx; x++) {
+        double best = std::numeric_limits<double>::infinity();
+        for (size_t j = 0; j < nsy; j++)
+        for (size_t i = 0; i < nsx; i++) {
+            if (map.bands[0][i + j * nsx] < 1)
+                continue;
+            double dx = 0.5 * (double(x) - double(i)),
+                   dy = 0.25 * (double(y) - double(j));
+            best = std::min(best, std::sqrt(dx * dx + dy * dy));
+        }
+        assert( std::abs(dist[x + y * nsx] - best) < 1e-4 );
+    }
+
+    // empty mask
+    gdalwrap::bytes_t empty(nsx * nsy, 0);
+    dist = gdalwrap::distance_transform(empty, nsx, nsy);
+    assert( std::isinf(dist[0]) );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,73 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <gdalwrap/fill.hpp>
+
+static const size_t nsx = 40;
+static const size_t nsy = 30;
+
+// plane z = x + 2 y with NaN holes
+gdalwrap::raster holes() {
+    gdalwrap::raster band(nsx * nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            band[x + y * nsx] = x + 2.0 * y;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (size_t y = 10; y < 16; y++)
+        for (size_t x = 5; x < 15; x++)
+            band[x + y * nsx] = nan;
+    band[30 + 20 * nsx] = nan;
+    return band;
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap fill test..." << std::endl;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    gdalwrap::raster band = holes();
+    assert( gdalwrap::fill_nearest(band, nsx, nsy, nan) == 61 );
+    assert( band[5 + 12 * nsx] == 4 + 2 * 12 );  // left border is closer
+    assert( band[30 + 20 * nsx] == 29 + 2 * 20 or
+            band[30 + 20 * nsx] == 31 + 2 * 20 or
+            band[30 + 20 * nsx] == 30 + 2 * 19 or
+            band[30 + 20 * nsx] == 30 + 2 * 21 );
+
+    // holes further than 2 pixels are kept
+    band = holes();
+    assert( gdalwrap::fill_nearest(band, nsx, nsy, nan, 2) == 1 + 60 - 6 * 2 );
+    assert( std::isnan(band[10 + 12 * nsx]) );
+
+    // idw of a plane is close to the plane for a symmetric hole
+    band = holes();
+    assert( gdalwrap::fill_idw(band, nsx, nsy, nan, 3) == 61 );
+    assert( std::abs(band[30 + 20 * nsx] - (30 + 2 * 20)) < 1e-3 );
+
+    // no limit: the window is clamped to the raster
+    band = holes();
+    assert( gdalwrap::fill_idw(band, nsx, nsy, nan,
+        std::numeric_limits<double>::infinity()) == 61 );
+
+    // in meters, with the finer scale: 1 m is 2 pixels
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 1, -0.5);
+    map.set_size(1, nsx, nsy);
+    map.bands[0] = holes();
+    assert( gdalwrap::fill(map, 0, nan, 1, gdalwrap::fill_method::nearest)
+        == 1 + 60 - 6 * 2 );
+    map.bands[0] = holes();
+    assert( gdalwrap::fill(map, 0, nan,
+        std::numeric_limits<double>::infinity(), gdalwrap::fill_method::idw)
+        == 61 );
+
+    // a plane is harmonic: the Laplace fill recovers it
+    band = holes();
+    assert( gdalwrap::fill_laplace(band, nsx, nsy, nan, 1e9, 50) == 61 );
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            assert( std::abs(band[x + y * nsx] - (x + 2.0 * y)) < 0.1 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,65 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdlib> // std::rand
+#include <iostream>
+#include <gdalwrap/geographic.hpp>
+
+static const size_t nsx = 2000;
+static const size_t nsy = 1000;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap geographic test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_size(1, nsx, nsy);
+    map.set_utm(31);
+    map.set_transform(374000, 4824000, 0.5, -0.5);
+    map.set_custom_origin(374500, 4823800);
+    gdalwrap::wgs84 geo(map);
+
+    // central meridian of zone 31 (3 E): easting 500 km, northing is the
+    // scaled meridian arc (0.9996 * 4984944.38 m at 45 N)
+    gdalwrap::point_xy_t p = geo.utm2lonlat(500000, 0);
+    assert( std::abs(p[0] - 3) < 1e-9 and std::abs(p[1]) < 1e-9 );
+    p = geo.lonlat2utm(3, 45);
+    assert( std::abs(p[0] - 500000) < 1e-3 );
+    assert( std::abs(p[1] - 4982950.4) < 1 );
+
+    // round trips, more points than a conversion chunk
+    gdalwrap::points_xy_t pix(10000), points;
+    for (auto& q : pix)
+        q = {{ std::rand() % (10 * nsx) / 10.0 - 0.5,
+               std::rand() % (10 * nsy) / 10.0 - 0.5 }};
+    points = pix;
+    geo.pix2lonlat(points);
+    gdalwrap::points_xy_t exact = points;
+    geo.lonlat2pix(points);
+    for (size_t i = 0; i < pix.size(); i++) {
+        assert( std::abs(points[i][0] - pix[i][0]) < 1e-5 );
+        assert( std::abs(points[i][1] - pix[i][1]) < 1e-5 );
+    }
+    points = {{{ 10, 20 }}};
+    geo.custom2lonlat(points);
+    geo.lonlat2custom(points);
+    assert( std::abs(points[0][0] - 10) < 1e-5 );
+    assert( std::abs(points[0][1] - 20) < 1e-5 );
+
+    // approximation grid every 50 pixels (25 m), points out of the raster
+    // use the exact transformation
+    geo.approximate(50);
+    points = pix;
+    points.push_back({{ -100, 30 }});
+    geo.pix2lonlat(points);
+    for (size_t i = 0; i < pix.size(); i++) {
+        assert( std::abs(points[i][0] - exact[i][0]) < 1e-8 );
+        assert( std::abs(points[i][1] - exact[i][1]) < 1e-8 );
+    }
+    gdalwrap::point_xy_t utm = map.point_pix2utm(-100, 30);
+    p = geo.utm2lonlat(utm[0], utm[1]);
+    assert( std::abs(points.back()[0] - p[0]) < 1e-9 );
+    assert( std::abs(points.back()[1] - p[1]) < 1e-9 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
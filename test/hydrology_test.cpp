@@ -0,0 +1,87 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <gdalwrap/hydrology.hpp>
+
+static const size_t nsx = 9;
+static const size_t nsy = 7;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap hydrology test..." << std::endl;
+
+    // valley sloping to the east, with a 2 cells pit in the middle
+    gdalwrap::raster dem(nsx * nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            dem[x + y * nsx] = 100 - 1.0 * x + 2 * std::abs(y - 3.0);
+    dem[4 + 3 * nsx] = 90;
+    dem[5 + 3 * nsx] = 91;
+
+    gdalwrap::raster flat(dem);
+    assert( gdalwrap::fill_pits(flat, nsx, nsy, false) == 2 );
+    // the pit is raised to its spill elevation (the lowest rim cell)
+    assert( flat[4 + 3 * nsx] == 94 );
+    assert( flat[5 + 3 * nsx] == 94 );
+    assert( flat[0 + 3 * nsx] == 100 );
+
+    gdalwrap::raster filled(dem);
+    gdalwrap::fill_pits(filled, nsx, nsy);
+    assert( filled[4 + 3 * nsx] > 94 and filled[4 + 3 * nsx] < 94.001 );
+    // the raised cells drain towards the spill point
+    assert( filled[4 + 3 * nsx] > filled[5 + 3 * nsx] );
+
+    // D8: the valley bottom drains east, the sides into the bottom
+    gdalwrap::raster d8 = gdalwrap::flow_direction_d8(filled, nsx, nsy);
+    for (size_t x = 0; x < nsx - 1; x++)
+        assert( d8[x + 3 * nsx] == 0 );
+    assert( d8[nsx - 1 + 3 * nsx] == -1 ); // outlet at the border
+    gdalwrap::raster acc = gdalwrap::flow_accumulation_d8(d8, nsx, nsy);
+    // every cell ends in the outlet or leaves by the border
+    assert( acc[nsx - 1 + 3 * nsx] > nsx );
+    double total = 0;
+    for (size_t i = 0; i < nsx * nsy; i++)
+        if (d8[i] < 0 or (d8[i] == 0 and i % nsx == nsx - 1))
+            total += acc[i];
+    assert( total == nsx * nsy );
+
+    // D-infinity: an inclined plane, flow splits by the angle
+    gdalwrap::raster plane(nsx * nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            plane[x + y * nsx] = -1.0 * x - std::tan(0.3) * y;
+    gdalwrap::raster dinf = gdalwrap::flow_direction_dinf(plane, nsx, nsy);
+    assert( std::abs(dinf[4 + 3 * nsx] - 0.3) < 1e-5 );
+    acc = gdalwrap::flow_accumulation_dinf(dinf, nsx, nsy);
+    assert( acc[0] == 1 );
+    assert( std::abs(acc[1] - (1 + 1 - 0.3 / (M_PI / 4))) < 1e-5 );
+
+    // flow of a map: no accumulation on the no-data cells
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 1, -1);
+    map.set_size(1, nsx, nsy);
+    map.bands[0] = plane;
+    map.bands[0][2 + 3 * nsx] = nan;
+    gdalwrap::gdal f = gdalwrap::flow(map, 0);
+    const gdalwrap::raster& fa = f.get_band(gdalwrap::flow_accumulation);
+    assert( std::isnan(fa[2 + 3 * nsx]) );
+    assert( fa[1 + 3 * nsx] >= 1 and fa[3 + 3 * nsx] >= 1 );
+    f = gdalwrap::flow(map, 0, true, -9999);
+    assert( f.get_band(gdalwrap::flow_accumulation)[2 + 3 * nsx] == -9999 );
+
+    // indices are 32 bits
+    bool thrown = false;
+    try {
+        gdalwrap::raster none;
+        gdalwrap::fill_pits(none, size_t(1) << 17, size_t(1) << 16);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert( thrown );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
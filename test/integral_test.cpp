@@ -0,0 +1,72 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <cstdlib> // std::rand
+#include <iostream>
+#include <gdalwrap/integral.hpp>
+
+static const size_t nsx = 37;
+static const size_t nsy = 29;
+
+// brute force sum, mean and variance of the clipped window
+static void brute(const gdalwrap::raster& band, long x0, long y0, long x1,
+        long y1, double& sum, double& mean, double& variance) {
+    sum = 0;
+    size_t n = 0;
+    for (long y = std::max(y0, 0L); y <= std::min(y1, long(nsy) - 1); y++)
+    for (long x = std::max(x0, 0L); x <= std::min(x1, long(nsx) - 1); x++) {
+        sum += band[x + y * nsx];
+        n++;
+    }
+    mean = sum / n;
+    variance = 0;
+    for (long y = std::max(y0, 0L); y <= std::min(y1, long(nsy) - 1); y++)
+    for (long x = std::max(x0, 0L); x <= std::min(x1, long(nsx) - 1); x++)
+        variance += std::pow(band[x + y * nsx] - mean, 2);
+    variance /= n;
+}
+
+static void check(const gdalwrap::integral& table,
+        const gdalwrap::raster& band, double offset) {
+    for (size_t k = 0; k < 500; k++) {
+        long x0 = std::rand() % (nsx + 4) - 2, x1 = x0 + std::rand() % 9;
+        long y0 = std::rand() % (nsy + 4) - 2, y1 = y0 + std::rand() % 9;
+        if (x0 >= long(nsx) or y0 >= long(nsy) or x1 < 0 or y1 < 0)
+            continue;
+        double sum, mean, variance;
+        brute(band, x0, y0, x1, y1, sum, mean, variance);
+        size_t n = table.count(x0, y0, x1, y1);
+        assert( std::abs(table.sum(x0, y0, x1, y1) - sum) < 1e-6 * n *
+            (1 + offset) );
+        assert( std::abs(table.mean(x0, y0, x1, y1) - mean) < 1e-6 );
+        // the noise variance is ~ 3e-5, much smaller than offset^2
+        assert( std::abs(table.variance(x0, y0, x1, y1) - variance)
+            < 1e-9 );
+    }
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap integral test..." << std::endl;
+
+    for (double offset : { 0.0, 1500.0 }) {
+        gdalwrap::raster band(nsx * nsy);
+        for (auto& v : band)
+            v = offset + 0.02 * (std::rand() / double(RAND_MAX) - 0.5);
+        gdalwrap::integral table(band, nsx, nsy);
+        assert( table.count(-5, -5, 100, 100) == nsx * nsy );
+        assert( table.count(nsx, 0, nsx + 2, 3) == 0 );
+        assert( std::isnan(table.mean(nsx, 0, nsx + 2, 3)) );
+        check(table, band, offset);
+
+        // update a window instead of rebuilding
+        for (size_t y = 10; y < 14; y++)
+            for (size_t x = 20; x < 25; x++)
+                band[x + y * nsx] += 0.01;
+        table.update(band, 20, 10, 24, 13);
+        check(table, band, offset);
+    }
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,54 @@
+#undef NDEBUG
+#include <cassert>
+#include <iostream>
+#include <gdalwrap/labeling.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap labeling test..." << std::endl;
+
+    // 0 1 1 0 0 1
+    // 0 0 1 0 1 0
+    // 1 0 0 0 0 0
+    // 1 1 0 1 1 1
+    const size_t width = 6, height = 4;
+    gdalwrap::bytes_t mask = {
+        0, 1, 1, 0, 0, 1,
+        0, 0, 1, 0, 1, 0,
+        1, 0, 0, 0, 0, 0,
+        1, 1, 0, 1, 1, 1 };
+    gdalwrap::labels_t labels;
+
+    gdalwrap::components_t four = gdalwrap::connected_components(mask,
+        width, height, labels, false);
+    assert( four.size() == 5 );
+    assert( labels[1] == 1 and labels[2] == 1 and labels[8] == 1 );
+    assert( labels[5] == 2 and labels[10] == 3 );
+    assert( labels[12] == 4 and labels[19] == 4 );
+    assert( four[4].area == 3 );
+    assert( four[4].min_x == 3 and four[4].max_x == 5 );
+    assert( four[4].centroid_x == 4 and four[4].centroid_y == 3 );
+
+    gdalwrap::components_t eight = gdalwrap::connected_components(mask,
+        width, height, labels, true);
+    assert( eight.size() == 4 );
+    assert( labels[5] == 2 and labels[10] == 2 );
+    assert( eight[1].area == 2 );
+    assert( eight[0].min_y == 0 and eight[0].max_y == 1 );
+
+    // one long snake over many rows, checks strip merging
+    const size_t size = 300;
+    gdalwrap::bytes_t snake(size * size, 0);
+    for (size_t y = 0; y < size; y += 2) {
+        for (size_t x = 0; x < size; x++)
+            snake[x + y * size] = 1;
+        if (y + 1 < size)
+            snake[((y / 2) % 2 ? 0 : size - 1) + (y + 1) * size] = 1;
+    }
+    gdalwrap::components_t one = gdalwrap::connected_components(snake,
+        size, size, labels, false);
+    assert( one.size() == 1 );
+    assert( one[0].area == size * size / 2 + size / 2 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
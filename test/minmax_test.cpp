@@ -0,0 +1,84 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdlib> // std::rand
+#include <algorithm>
+#include <iostream>
+#include <gdalwrap/minmax.hpp>
+
+static const long nsx = 53;
+static const long nsy = 29;
+
+// compare the pyramid with a brute force scan of random windows
+void check(const gdalwrap::minmax& pyramid, const gdalwrap::raster& band) {
+    for (int k = 0; k < 500; k++) {
+        // partly out of the band, corners in any order
+        long x0 = std::rand() % (nsx + 10) - 5,
+             x1 = std::rand() % (nsx + 10) - 5,
+             y0 = std::rand() % (nsy + 10) - 5,
+             y1 = std::rand() % (nsy + 10) - 5;
+        float threshold = std::rand() % 1000 - 500;
+        float lo = INFINITY, hi = -INFINITY;
+        for (long y = std::max(0L, std::min(y0, y1));
+                y <= std::min(nsy - 1, std::max(y0, y1)); y++)
+            for (long x = std::max(0L, std::min(x0, x1));
+                    x <= std::min(nsx - 1, std::max(x0, x1)); x++) {
+                lo = std::min(lo, band[x + y * nsx]);
+                hi = std::max(hi, band[x + y * nsx]);
+            }
+        if (std::isinf(lo)) { // empty window
+            assert( std::isnan(pyramid.min(x0, y0, x1, y1)) );
+            assert( std::isnan(pyramid.max(x0, y0, x1, y1)) );
+            assert( !pyramid.any_above(x0, y0, x1, y1, threshold) );
+            continue;
+        }
+        assert( pyramid.min(x0, y0, x1, y1) == lo );
+        assert( pyramid.max(x0, y0, x1, y1) == hi );
+        assert( pyramid.any_above(x0, y0, x1, y1, threshold) ==
+                (hi > threshold) );
+        assert( pyramid.any_below(x0, y0, x1, y1, threshold) ==
+                (lo < threshold) );
+    }
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap minmax test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    for (auto& v : map.bands[0])
+        v = std::rand() % 1000 - 500;
+    gdalwrap::minmax pyramid(map, 0);
+    assert( pyramid.get_width() == size_t(nsx) );
+    assert( pyramid.get_height() == size_t(nsy) );
+    assert( pyramid.get_levels() > 1 );
+    check(pyramid, map.bands[0]);
+
+    // single cell window
+    assert( pyramid.max(7, 3, 7, 3) == map.bands[0][7 + 3 * nsx] );
+
+    // updates, up and down
+    for (int k = 0; k < 200; k++) {
+        long x = std::rand() % nsx, y = std::rand() % nsy;
+        float v = std::rand() % 2000 - 1000;
+        map.bands[0][x + y * nsx] = v;
+        pyramid.update(x, y, v);
+        assert( pyramid.get(x, y) == v );
+    }
+    check(pyramid, map.bands[0]);
+
+    // windows between UTM corners, in any order
+    map.bands[0][20 + 10 * nsx] = 2000;
+    pyramid.update(20, 10, 2000);
+    gdalwrap::point_xy_t a = map.point_pix2utm(18, 12),
+                         b = map.point_pix2utm(22, 8);
+    assert( pyramid.max_utm(a[0], a[1], b[0], b[1]) == 2000 );
+    assert( pyramid.any_above_utm(b[0], b[1], a[0], a[1], 1999) );
+    assert( !pyramid.any_above_utm(b[0], b[1], a[0], a[1], 2000) );
+    b = map.point_pix2utm(19, 8);
+    assert( pyramid.max_utm(a[0], a[1], b[0], b[1]) < 2000 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
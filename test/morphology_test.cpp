@@ -0,0 +1,92 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdlib> // std::rand
+#include <algorithm>
+#include <iostream>
+#include <gdalwrap/morphology.hpp>
+
+static const long nsx = 37;
+static const long nsy = 23;
+
+// brute force max (or min) over the cells (dx, dy) of the element,
+// the cells out of the band are ignored
+template <class T, class In>
+std::vector<T> brute(const std::vector<T>& band, bool dilate, In in,
+        long rx, long ry) {
+    std::vector<T> result(band.size());
+    for (long y = 0; y < nsy; y++)
+        for (long x = 0; x < nsx; x++) {
+            T best = band[x + y * nsx];
+            for (long dy = -ry; dy <= ry; dy++)
+                for (long dx = -rx; dx <= rx; dx++) {
+                    long sx = x + dx, sy = y + dy;
+                    if (sx < 0 or sy < 0 or sx >= nsx or sy >= nsy or
+                            !in(dx, dy))
+                        continue;
+                    T v = band[sx + sy * nsx];
+                    best = dilate ? std::max(best, v) : std::min(best, v);
+                }
+            result[x + y * nsx] = best;
+        }
+    return result;
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap morphology test..." << std::endl;
+
+    gdalwrap::raster band(nsx * nsy);
+    gdalwrap::bytes_t mask(nsx * nsy);
+    for (long i = 0; i < nsx * nsy; i++) {
+        band[i] = std::rand() % 1000 - 500;
+        mask[i] = std::rand() % 10 == 0;
+    }
+    auto all = [](long, long) { return true; };
+
+    // rectangles, including wider than the band
+    const long rects[][2] = { {0, 0}, {1, 2}, {3, 1}, {10, 7}, {40, 30} };
+    for (const auto& r : rects) {
+        assert( gdalwrap::dilate_rect(band, nsx, nsy, r[0], r[1]) ==
+                brute(band, true, all, r[0], r[1]) );
+        assert( gdalwrap::erode_rect(band, nsx, nsy, r[0], r[1]) ==
+                brute(band, false, all, r[0], r[1]) );
+        assert( gdalwrap::dilate_rect(mask, nsx, nsy, r[0], r[1]) ==
+                brute(mask, true, all, r[0], r[1]) );
+        assert( gdalwrap::erode_rect(mask, nsx, nsy, r[0], r[1]) ==
+                brute(mask, false, all, r[0], r[1]) );
+    }
+
+    // discs and ellipses
+    const double discs[][2] = { {0, 0}, {1, 1}, {2.5, 1.5}, {3, 3},
+                                {0.5, 4}, {6, 2} };
+    for (const auto& d : discs) {
+        double rx = d[0], ry = d[1];
+        auto in = [rx, ry](long dx, long dy) {
+            double tx = rx > 0 ? dx / rx : (dx ? 2 : 0),
+                   ty = ry > 0 ? dy / ry : (dy ? 2 : 0);
+            return tx * tx + ty * ty <= 1 + 1e-9;
+        };
+        long nx = std::floor(rx), ny = std::floor(ry);
+        assert( gdalwrap::dilate_disc(band, nsx, nsy, rx, ry) ==
+                brute(band, true, in, nx, ny) );
+        assert( gdalwrap::erode_disc(band, nsx, nsy, rx, ry) ==
+                brute(band, false, in, nx, ny) );
+        assert( gdalwrap::dilate_disc(mask, nsx, nsy, rx, ry) ==
+                brute(mask, true, in, nx, ny) );
+    }
+
+    // meters: a single obstacle inflated by 1 m on a 0.5 m grid
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    map.bands[0][10 + 10 * nsx] = 1;
+    gdalwrap::raster inflated = gdalwrap::dilate(map, 0, 1);
+    size_t count = 0;
+    for (float v : inflated)
+        count += v == 1;
+    assert( count == 13 ); // cells within 2 pixels
+    assert( inflated[12 + 10 * nsx] == 1 and inflated[12 + 11 * nsx] == 0 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <iostream>
+#include <gdalwrap/occupancy.hpp>
+
+static const long nsx = 40;
+static const long nsy = 30;
+
+// true if the segment (in pixels, boundaries at integers + 0.5) crosses
+// the inside of the cell (x, y)
+bool crosses(double ax, double ay, double bx, double by, long x, long y) {
+    double t0 = 0, t1 = 1;
+    double a[2] = { ax, ay }, d[2] = { bx - ax, by - ay };
+    double lo[2] = { x - 0.5, y - 0.5 };
+    for (int k = 0; k < 2; k++) {
+        if (d[k] == 0) {
+            if (a[k] <= lo[k] or a[k] >= lo[k] + 1)
+                return false;
+            continue;
+        }
+        double ta = (lo[k] - a[k]) / d[k], tb = (lo[k] + 1 - a[k]) / d[k];
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+    }
+    return t0 < t1;
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap occupancy test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    gdalwrap::log_odds_t params = { 2, -1, -100, 100 };
+
+    // rays inside, across and outside of the map, against a brute force
+    // traversal of all the cells
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> px(-2 * nsx, 3 * nsx),
+                                           py(-2 * nsy, 3 * nsy);
+    for (int k = 0; k < 500; k++) {
+        double ax = px(rng), ay = py(rng), bx = px(rng), by = py(rng);
+        if (k % 4 == 0) { // end in the map
+            bx = std::fmod(std::abs(bx), nsx - 1);
+            by = std::fmod(std::abs(by), nsy - 1);
+        }
+        std::fill(map.bands[0].begin(), map.bands[0].end(), 0);
+        gdalwrap::rays_t rays = {{ map.point_pix2utm(ax, ay),
+                                   map.point_pix2utm(bx, by) }};
+        gdalwrap::raycast(map, 0, rays, params);
+        long ex = std::round(bx), ey = std::round(by);
+        for (long y = 0; y < nsy; y++)
+            for (long x = 0; x < nsx; x++) {
+                float expected = 0;
+                if (x == ex and y == ey)
+                    expected = params.hit;
+                else if (crosses(ax, ay, bx, by, x, y))
+                    expected = params.miss;
+                assert( map.bands[0][x + y * nsx] == expected );
+            }
+    }
+
+    // a far away sensor only updates the cells in the map
+    std::fill(map.bands[0].begin(), map.bands[0].end(), 0);
+    gdalwrap::rays_t rays = {{ map.point_pix2utm(-1e7, 10),
+                               map.point_pix2utm(1e7, 10) }};
+    gdalwrap::raycast(map, 0, rays, params);
+    for (long y = 0; y < nsy; y++)
+        for (long x = 0; x < nsx; x++)
+            assert( map.bands[0][x + y * nsx] == (y == 10 ? -1 : 0) );
+
+    // clamping
+    gdalwrap::ray_t ray = { map.point_pix2utm(0, 0), map.point_pix2utm(5, 0) };
+    rays.assign(300, ray);
+    gdalwrap::raycast(map, 0, rays, params);
+    assert( map.bands[0][0] == -100 );
+    assert( map.bands[0][5] == 100 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
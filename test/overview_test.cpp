@@ -0,0 +1,108 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <cstdlib> // std::rand
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include <gdalwrap/overview.hpp>
+
+static const size_t nsx = 13;
+static const size_t nsy = 9;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap overview test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    for (auto& v : map.bands[0])
+        v = std::rand() % 4; // few values, for the mode
+
+    // every reduction against a brute force scan of the (partial) blocks
+    const size_t factor = 3;
+    gdalwrap::reduction methods[] = { gdalwrap::reduction::nearest,
+        gdalwrap::reduction::mean, gdalwrap::reduction::min,
+        gdalwrap::reduction::max, gdalwrap::reduction::mode };
+    for (auto method : methods) {
+        gdalwrap::gdal low = gdalwrap::overview(map, factor, method);
+        assert( low.get_width() == 5 and low.get_height() == 3 );
+        assert( low.get_scale_x() == 1.5 and low.get_scale_y() == -1.5 );
+        // the first cell is centered on its block
+        gdalwrap::point_xy_t p = map.point_pix2utm(1, 1);
+        assert( low.get_utm_pose_x() == p[0] );
+        assert( low.get_utm_pose_y() == p[1] );
+        for (size_t oy = 0; oy < 3; oy++)
+            for (size_t ox = 0; ox < 5; ox++) {
+                double sum = 0;
+                float lo = INFINITY, hi = -INFINITY;
+                std::map<float, size_t> counts;
+                size_t n = 0;
+                size_t x1 = std::min(nsx, (ox + 1) * factor),
+                       y1 = std::min(nsy, (oy + 1) * factor);
+                for (size_t y = oy * factor; y < y1; y++)
+                    for (size_t x = ox * factor; x < x1; x++) {
+                        float v = map.bands[0][x + y * nsx];
+                        sum += v;
+                        lo = std::min(lo, v);
+                        hi = std::max(hi, v);
+                        counts[v]++;
+                        n++;
+                    }
+                float mode = 0;
+                size_t best = 0;
+                for (const auto& c : counts) // ascending: smallest on ties
+                    if (c.second > best) {
+                        best = c.second;
+                        mode = c.first;
+                    }
+                float v = low.bands[0][ox + oy * 5];
+                switch (method) {
+                case gdalwrap::reduction::nearest:
+                    // center cell of the block, clamped
+                    assert( v == map.bands[0][std::min(nsx - 1, ox * 3 + 1) +
+                                    std::min(nsy - 1, oy * 3 + 1) * nsx] );
+                    break;
+                case gdalwrap::reduction::mean:
+                    assert( std::abs(v - sum / n) < 1e-5 );
+                    break;
+                case gdalwrap::reduction::min:
+                    assert( v == lo );
+                    break;
+                case gdalwrap::reduction::max:
+                    assert( v == hi );
+                    break;
+                case gdalwrap::reduction::mode:
+                    assert( v == mode );
+                    break;
+                }
+            }
+    }
+
+    // pyramid: nested blocks, min / max are exact at every level
+    std::vector<gdalwrap::gdal> pyramid = gdalwrap::overviews(map, 3,
+        gdalwrap::reduction::max);
+    assert( pyramid.size() == 3 );
+    for (size_t level = 0; level < 3; level++) {
+        gdalwrap::gdal direct = gdalwrap::overview(map, 2 << level,
+            gdalwrap::reduction::max);
+        assert( pyramid[level].bands[0] == direct.bands[0] );
+        assert( pyramid[level].get_transform() == direct.get_transform() );
+    }
+    // mean of means is exact with full blocks
+    map.set_size(1, 16, 8);
+    for (auto& v : map.bands[0])
+        v = std::rand() % 100;
+    pyramid = gdalwrap::overviews(map, 3);
+    gdalwrap::gdal direct = gdalwrap::overview(map, 8);
+    assert( pyramid[2].get_width() == 2 and pyramid[2].get_height() == 1 );
+    for (size_t i = 0; i < 2; i++)
+        assert( std::abs(pyramid[2].bands[0][i] - direct.bands[0][i]) < 1e-4 );
+
+    using gdalwrap::resampling_name;
+    assert( resampling_name(gdalwrap::reduction::mean) == "AVERAGE" );
+    assert( resampling_name(gdalwrap::reduction::mode) == "MODE" );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <ogr_geometry.h>
+#include <gdalwrap/polygon.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap polygon test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_size(1, 20, 10);
+    map.set_transform(100, 200, 1, -1);
+    // square [2, 12] x [1, 9] in pixels with a [5, 8] x [3, 6] hole
+    gdalwrap::polygon_t square = {
+        {{{{102, 199}}, {{112, 199}}, {{112, 191}}, {{102, 191}}}},
+        {{{{105, 197}}, {{108, 197}}, {{108, 194}}, {{105, 194}}}},
+    };
+    gdalwrap::rasterize(map, 0, gdalwrap::polygons_t{ square }, 3);
+    size_t count = 0;
+    for (float v : map.bands[0])
+        count += v == 3;
+    // cell centers in [2, 12[ x [1, 9[ minus [5, 8[ x [3, 6[
+    assert( count == 10 * 8 - 3 * 3 );
+    assert( map.bands[0][2 + 1 * 20] == 3 );
+    assert( map.bands[0][12 + 1 * 20] == 0 );
+    assert( map.bands[0][5 + 3 * 20] == 0 );
+
+    // the same square from OGR (WKT in UTM), alone and in a multi polygon
+    const char *wkts[2] = {
+        "POLYGON ((102 199,112 199,112 191,102 191,102 199),"
+                 "(105 197,108 197,108 194,105 194,105 197))",
+        "MULTIPOLYGON (((102 199,112 199,112 191,102 191,102 199),"
+                      "(105 197,108 197,108 194,105 194,105 197)),"
+                      "((114 199,116 199,116 197,114 197,114 199)))",
+    };
+    for (int k = 0; k < 2; k++) {
+        OGRGeometry *geometry = NULL;
+        assert( OGRGeometryFactory::createFromWkt(wkts[k], NULL, &geometry)
+                == OGRERR_NONE );
+        gdalwrap::gdal ogr(map);
+        ogr.bands[0].assign(20 * 10, 0);
+        gdalwrap::rasterize(ogr, 0, geometry, 3);
+        OGRGeometryFactory::destroyGeometry(geometry);
+        size_t cells = 0;
+        for (float v : ogr.bands[0])
+            cells += v == 3;
+        // the second polygon of the multi polygon covers 2 x 2 cells
+        assert( cells == count + (k ? 4 : 0) );
+        assert( ogr.bands[0][5 + 3 * 20] == 0 );
+        assert( ogr.bands[0][14 + 1 * 20] == (k ? 3 : 0) );
+    }
+    // not a polygon
+    OGRGeometry *line = NULL;
+    OGRGeometryFactory::createFromWkt("LINESTRING (102 199,112 191)", NULL,
+        &line);
+    bool thrown = false;
+    try {
+        gdalwrap::rasterize(map, 0, line, 3);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert( thrown );
+    OGRGeometryFactory::destroyGeometry(line);
+
+    // a triangle, even-odd of the diagonal
+    gdalwrap::raster band(10 * 10, 0);
+    gdalwrap::polygon_t triangle = {
+        {{{{-0.5, -0.5}}, {{9.5, -0.5}}, {{9.5, 9.5}}}},
+    };
+    gdalwrap::rasterize(band, 10, 10, gdalwrap::polygons_t{ triangle }, 1);
+    for (size_t y = 0; y < 10; y++)
+        for (size_t x = 0; x < 10; x++)
+            assert( band[x + y * 10] == (x >= y) );
+
+    // polygonize the rasterized square back, label 3
+    gdalwrap::regions_t regions = gdalwrap::polygonize(map, 0);
+    assert( regions.size() == 1 );
+    assert( regions[0].label == 3 );
+    assert( regions[0].rings.size() == 2 );
+    // exterior: 4 corners + closing point, on cell borders
+    const gdalwrap::points_xy_t& exterior = regions[0].rings[0];
+    assert( exterior.size() == 5 );
+    assert( exterior.front() == exterior.back() );
+    assert( exterior[0][0] == 101.5 and exterior[0][1] == 199.5 );
+    assert( regions[0].rings[1].size() == 5 );
+
+    // two 4-connected areas touching by a corner, and a nested island
+    std::vector<uint32_t> labels = {
+        1, 0, 0, 0, 0, 0, 0,
+        0, 1, 2, 2, 2, 2, 2,
+        0, 0, 2, 0, 0, 0, 2,
+        0, 0, 2, 0, 2, 0, 2,
+        0, 0, 2, 0, 0, 0, 2,
+        0, 0, 2, 2, 2, 2, 2,
+    };
+    regions = gdalwrap::polygonize(labels, 7, 6);
+    assert( regions.size() == 4 );
+    size_t holes = 0;
+    for (const auto& r : regions)
+        holes += r.rings.size() - 1;
+    assert( holes == 1 );
+    // the island is in its own region, inside the hole
+    assert( regions[3].label == 2 and regions[3].rings.size() == 1 );
+    assert( regions[3].rings[0].size() == 5 );
+
+    // nested rings of the same label: each hole goes to the ring around it
+    size_t n = 9;
+    labels.assign(n * n, 0);
+    for (size_t y = 0; y < n; y++)
+        for (size_t x = 0; x < n; x++) {
+            size_t d = std::min(std::min(x, y),
+                                std::min(n - 1 - x, n - 1 - y));
+            labels[x + y * n] = (d % 2 == 0) ? 1 : 0;
+        }
+    regions = gdalwrap::polygonize(labels, n, n);
+    assert( regions.size() == 3 );
+    assert( regions[0].rings.size() == 2 and regions[1].rings.size() == 2 );
+    assert( regions[2].rings.size() == 1 ); // center cell
+    for (size_t r = 0; r < 2; r++)
+        for (const auto& p : regions[r].rings[1])
+            assert( std::min(p[0], p[1]) >= 0.5 + 2 * r and
+                    std::max(p[0], p[1]) <= n - 1.5 - 2 * r );
+
+    // a grid of holes in one region
+    n = 201;
+    labels.assign(n * n, 1);
+    for (size_t y = 1; y < n - 1; y += 2)
+        for (size_t x = 1; x < n - 1; x += 2)
+            labels[x + y * n] = 0;
+    regions = gdalwrap::polygonize(labels, n, n);
+    assert( regions.size() == 1 );
+    assert( regions[0].rings.size() == 1 + 100 * 100 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
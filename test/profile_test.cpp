@@ -0,0 +1,54 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <gdalwrap/profile.hpp>
+
+static const size_t nsx = 40;
+static const size_t nsy = 30;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap profile test..." << std::endl;
+
+    // plane z = x + 2 y (in meters), exact with bilinear sampling
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++) {
+            gdalwrap::point_xy_t p = map.point_pix2utm(x, y);
+            map.bands[0][x + y * nsx] = (p[0] - 100) + 2 * (p[1] - 200);
+        }
+
+    // 1 m every 0.1 m: 11 samples, the last vertex is not duplicated
+    gdalwrap::raster z = gdalwrap::profile(map, 0,
+        {{101, 195}, {102, 195}}, 0.1);
+    assert( z.size() == 11 );
+    for (size_t k = 0; k < z.size(); k++)
+        assert( std::abs(z[k] - (1 + 0.1 * k - 10)) < 1e-4 );
+
+    // 2 segments of 1.05 m and 0.95 m: samples every 0.1 m of curvilinear
+    // abscissa, through the corner
+    z = gdalwrap::profile(map, 0,
+        {{101, 195}, {102.05, 195}, {102.05, 194.05}}, 0.1);
+    assert( z.size() == 21 );
+    for (size_t k = 0; k < z.size(); k++) {
+        double s = 0.1 * k, x = 1 + std::min(s, 1.05),
+               y = -5 - std::max(0.0, s - 1.05);
+        assert( std::abs(z[k] - (x + 2 * y)) < 1e-4 );
+    }
+
+    // step longer than the polyline: both ends
+    z = gdalwrap::profile(map, 0, {{101, 195}, {103, 195}}, 5);
+    assert( z.size() == 2 );
+    assert( std::abs(z[1] - (3 - 10)) < 1e-4 );
+
+    // out of the raster, and several polylines in parallel
+    gdalwrap::rasters zs = gdalwrap::profiles(map, 0,
+        {{{101, 195}, {102, 195}}, {{50, 50}, {51, 50}}}, 0.5, false, -1);
+    assert( zs.size() == 2 and zs[0].size() == 3 and zs[1].size() == 3 );
+    assert( zs[1][0] == -1 and zs[1][2] == -1 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
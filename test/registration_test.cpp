@@ -0,0 +1,81 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <gdalwrap/registration.hpp>
+
+static const size_t n = 128;
+
+// smooth terrain: sum of gaussian bumps, defined at any sub-pixel position
+struct terrain {
+    std::vector<double> bumps; // x, y, height
+    double sigma;
+    terrain(double sigma) : sigma(sigma) {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<double> pos(-10, n + 10), z(-1, 1);
+        for (size_t i = 0; i < n * n / 6; i++) {
+            bumps.push_back(pos(rng));
+            bumps.push_back(pos(rng));
+            bumps.push_back(z(rng));
+        }
+    }
+    double operator()(double x, double y) const {
+        double v = 0;
+        for (size_t i = 0; i < bumps.size(); i += 3) {
+            double dx = x - bumps[i], dy = y - bumps[i + 1];
+            if (std::abs(dx) < 5 * sigma and std::abs(dy) < 5 * sigma)
+                v += bumps[i + 2] * std::exp(-(dx * dx + dy * dy) /
+                                             (2 * sigma * sigma));
+        }
+        return v;
+    }
+};
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap registration test..." << std::endl;
+
+    const double shifts[][2] = {
+        {2, 1}, {1.5, 0.5}, {-0.3, 0.7}, {3.25, -2.75}, {0, 0},
+    };
+    for (double sigma : {1.0, 2.0}) {
+        terrain z(sigma);
+        gdalwrap::raster reference(n * n);
+        for (size_t y = 0; y < n; y++)
+            for (size_t x = 0; x < n; x++)
+                reference[x + y * n] = z(x, y);
+        for (const auto& s : shifts) {
+            gdalwrap::raster moving(n * n);
+            for (size_t y = 0; y < n; y++)
+                for (size_t x = 0; x < n; x++)
+                    moving[x + y * n] = z(x - s[0], y - s[1]);
+            double peak;
+            gdalwrap::point_xy_t shift = gdalwrap::phase_correlation(
+                reference, moving, n, n, NAN, &peak);
+            assert( std::abs(shift[0] - s[0]) < 0.1 );
+            assert( std::abs(shift[1] - s[1]) < 0.1 );
+            assert( peak > 0.1 and peak <= 1 );
+        }
+    }
+
+    // survey shifted by (1.5, -0.75) m on a 0.5 m grid
+    terrain z(2);
+    gdalwrap::gdal reference, survey;
+    reference.set_transform(1000, 2000, 0.5, -0.5);
+    reference.set_size(1, n, n);
+    survey.set_transform(1000, 2000, 0.5, -0.5);
+    survey.set_size(1, n, n);
+    for (size_t y = 0; y < n; y++)
+        for (size_t x = 0; x < n; x++) {
+            reference.bands[0][x + y * n] = z(x, y);
+            survey.bands[0][x + y * n] = z(x - 3, y - 1.5);
+        }
+    gdalwrap::point_xy_t offset = gdalwrap::register_translation(
+        reference, 0, survey, 0);
+    assert( std::abs(offset[0] - -1.5) < 0.05 );
+    assert( std::abs(offset[1] - 0.75) < 0.05 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
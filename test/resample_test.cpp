@@ -0,0 +1,75 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <gdalwrap/resample.hpp>
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap resample test..." << std::endl;
+
+    // 101 x 61 px at 5 cm, the value of a cell is its UTM x + 2 y
+    gdalwrap::gdal map;
+    map.set_transform(1000, 2000, 0.05, -0.05);
+    map.set_size(1, 101, 61);
+    for (size_t y = 0; y < 61; y++)
+        for (size_t x = 0; x < 101; x++) {
+            gdalwrap::point_xy_t p = map.point_pix2utm(x, y);
+            map.bands[0][x + y * 101] = (p[0] - 1000) + 2 * (p[1] - 2000);
+        }
+
+    // 5 cm to 1 m: 5 x 3 cells of exactly 1 m
+    for (auto method : { gdalwrap::interpolation::area,
+                         gdalwrap::interpolation::bilinear }) {
+        gdalwrap::gdal low = gdalwrap::resample(map, 1, -1, method);
+        assert( low.get_width() == 5 and low.get_height() == 3 );
+        assert( low.get_scale_x() == 1 and low.get_scale_y() == -1 );
+        // same corner: center of the cell 0 is half a new cell inside
+        assert( std::abs(low.get_utm_pose_x() - (1000 - 0.025 + 0.5))
+            < 1e-9 );
+        assert( std::abs(low.get_utm_pose_y() - (2000 + 0.025 - 0.5))
+            < 1e-9 );
+        // a plane is sampled at the cell centers of the geotransform,
+        // (the stretched bilinear kernel is clipped on the border cells)
+        bool area = method == gdalwrap::interpolation::area;
+        for (size_t y = area ? 0 : 1; y < (area ? 3 : 2); y++)
+            for (size_t x = area ? 0 : 1; x < (area ? 5 : 4); x++) {
+                gdalwrap::point_xy_t p = low.point_pix2utm(x, y);
+                float expected = (p[0] - 1000) + 2 * (p[1] - 2000);
+                assert( std::abs(low.bands[0][x + y * 5] - expected)
+                    < 1e-3 );
+            }
+    }
+
+    // the sign of the target scale is ignored, the map's one is kept
+    gdalwrap::gdal positive = gdalwrap::resample(map, 1, 1);
+    assert( positive.get_width() == 5 and positive.get_height() == 3 );
+    assert( positive.get_scale_x() == 1 and positive.get_scale_y() == -1 );
+    assert( positive.bands[0] ==
+            gdalwrap::resample(map, -1, -1).bands[0] );
+
+    // resize keeps the extent
+    gdalwrap::gdal half = gdalwrap::resize(map, 50, 30,
+        gdalwrap::interpolation::nearest);
+    assert( std::abs(half.get_scale_x() - 0.05 * 101 / 50) < 1e-12 );
+    gdalwrap::point_xy_t c0 = map.point_pix2utm(-0.5, -0.5);
+    gdalwrap::point_xy_t c1 = half.point_pix2utm(-0.5, -0.5);
+    assert( std::abs(c0[0] - c1[0]) < 1e-9 and std::abs(c0[1] - c1[1])
+        < 1e-9 );
+    c0 = map.point_pix2utm(100.5, 60.5);
+    c1 = half.point_pix2utm(49.5, 29.5);
+    assert( std::abs(c0[0] - c1[0]) < 1e-9 and std::abs(c0[1] - c1[1])
+        < 1e-9 );
+
+    bool thrown = false;
+    try {
+        gdalwrap::resize(map, 0, 10);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert( thrown );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <iostream>
+#include <gdalwrap/shading.hpp>
+
+static const size_t nsx = 20;
+static const size_t nsy = 15;
+
+static int expected_byte(double v) { // [0,1] to [0,255]
+    return std::max(0.0, std::min(255.0, std::floor(255 * v + 0.5)));
+}
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap shading test..." << std::endl;
+
+    // plane z = a e + b n (east, north in meters), on every cell
+    const double a = 0.5, b = -0.25;
+    gdalwrap::gdal map;
+    map.set_transform(100, 200, 0.5, -0.5);
+    map.set_size(1, nsx, nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++) {
+            gdalwrap::point_xy_t p = map.point_pix2utm(x, y);
+            map.bands[0][x + y * nsx] = a * (p[0] - 100) + b * (p[1] - 200);
+        }
+    const double norm = std::sqrt(a * a + b * b + 1);
+    const double nx = -a / norm, ny = -b / norm, nz = 1 / norm;
+
+    gdalwrap::gdal n = gdalwrap::normals(map, 0);
+    assert( n.bands.size() == 3 and n.get_width() == nsx );
+    for (size_t i = 0; i < nsx * nsy; i++) {
+        assert( std::abs(n.get_band(gdalwrap::normal_x)[i] - nx) < 1e-5 );
+        assert( std::abs(n.get_band(gdalwrap::normal_y)[i] - ny) < 1e-5 );
+        assert( std::abs(n.get_band(gdalwrap::normal_z)[i] - nz) < 1e-5 );
+    }
+    // vertical exaggeration: twice the slope
+    n = gdalwrap::normals(map, 0, 2);
+    double n2 = std::sqrt(4 * a * a + 4 * b * b + 1);
+    assert( std::abs(n.bands[0][0] + 2 * a / n2) < 1e-5 );
+    assert( std::abs(n.bands[2][nsx * nsy - 1] - 1 / n2) < 1e-5 );
+
+    // normal maps: [-1,1] to bytes, octahedral on |x| + |y| + |z| = 1
+    std::vector<gdalwrap::bytes_t> rgb = gdalwrap::normal_map(map, 0);
+    std::vector<gdalwrap::bytes_t> oct = gdalwrap::normal_map(map, 0, true);
+    assert( rgb.size() == 3 and oct.size() == 2 );
+    double l1 = std::abs(a) + std::abs(b) + 1;
+    for (size_t i = 0; i < nsx * nsy; i++) {
+        assert( std::abs(rgb[0][i] - expected_byte(nx / 2 + 0.5)) <= 1 );
+        assert( std::abs(rgb[1][i] - expected_byte(ny / 2 + 0.5)) <= 1 );
+        assert( std::abs(rgb[2][i] - expected_byte(nz / 2 + 0.5)) <= 1 );
+        assert( std::abs(oct[0][i] - expected_byte(-a / l1 / 2 + 0.5)) <= 1 );
+        assert( std::abs(oct[1][i] - expected_byte(-b / l1 / 2 + 0.5)) <= 1 );
+    }
+
+    // hillshade: 255 cos of the angle between the normal and the light
+    for (double azimuth : { 0.0, 90.0, 200.0, 315.0 }) {
+        for (double altitude : { 10.0, 45.0, 90.0 }) {
+            double az = azimuth * M_PI / 180, alt = altitude * M_PI / 180;
+            double shade = nx * std::sin(az) * std::cos(alt) +
+                           ny * std::cos(az) * std::cos(alt) +
+                           nz * std::sin(alt);
+            gdalwrap::bytes_t s = gdalwrap::hillshade(map, 0, azimuth,
+                altitude);
+            assert( s.size() == nsx * nsy );
+            for (size_t i = 0; i < s.size(); i++)
+                assert( std::abs(s[i] - expected_byte(shade)) <= 1 );
+        }
+    }
+
+    // flat: sin of the altitude, a steep slope facing away: in the shadow
+    gdalwrap::raster dem(nsx * nsy, 3);
+    gdalwrap::bytes_t s = gdalwrap::hillshade(dem, nsx, nsy, 1, -1, 0, 30);
+    for (size_t i = 0; i < s.size(); i++)
+        assert( s[i] == 128 );
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++)
+            dem[x + y * nsx] = 10.0 * x; // rising to the east
+    s = gdalwrap::hillshade(dem, nsx, nsy, 1, -1, 90, 30);
+    for (size_t i = 0; i < s.size(); i++)
+        assert( s[i] == 0 );
+
+    // NaN: 0 on the cell and its 3x3 neighbours only
+    map.bands[0][5 + 7 * nsx] = std::numeric_limits<float>::quiet_NaN();
+    s = gdalwrap::hillshade(map, 0);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++) {
+            bool near = std::abs(long(x) - 5) <= 1 and
+                        std::abs(long(y) - 7) <= 1;
+            assert( (s[x + y * nsx] == 0) == near );
+        }
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <cstdlib> // std::rand
+#include <iostream>
+#include <gdalwrap/smoothing.hpp>
+
+static const size_t nsx = 200;
+static const size_t nsy = 200;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap smoothing test..." << std::endl;
+
+    // flat terrain with 0.01 noise, at sea level and at 1500 m
+    gdalwrap::raster noise(nsx * nsy);
+    for (auto& v : noise)
+        v = 0.02 * (std::rand() / double(RAND_MAX) - 0.5);
+    gdalwrap::raster low(noise), high(noise);
+    for (auto& v : high)
+        v += 1500;
+    const double eps = 0.05 * 0.05;
+    gdalwrap::raster f0 = gdalwrap::guided_filter(low, low, nsx, nsy, 3, eps);
+    gdalwrap::raster f1 = gdalwrap::guided_filter(high, high, nsx, nsy, 3,
+        eps);
+    double max_noise = 0, max_low = 0, max_diff = 0;
+    for (size_t i = 0; i < nsx * nsy; i++) {
+        max_noise = std::max(max_noise, std::abs(double(noise[i])));
+        max_low = std::max(max_low, std::abs(double(f0[i])));
+        // same result up to the float resolution at 1500 (1.2e-4)
+        max_diff = std::max(max_diff, std::abs(f1[i] - 1500.0 - f0[i]));
+    }
+    assert( max_low < max_noise / 2 ); // smoothed
+    assert( max_diff < 2.5e-4 );
+
+    // a 1 m step (rock edge) is kept
+    gdalwrap::raster step(high);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = nsx / 2; x < nsx; x++)
+            step[x + y * nsx] += 1;
+    gdalwrap::raster fs = gdalwrap::guided_filter(step, step, nsx, nsy, 3,
+        eps);
+    size_t y = nsy / 2;
+    assert( std::abs(fs[nsx / 2 - 1 + y * nsx] - 1500) < 0.02 );
+    assert( std::abs(fs[nsx / 2 + y * nsx] - 1501) < 0.02 );
+
+    // the bilateral filter keeps the step too
+    fs = gdalwrap::bilateral_filter(step, nsx, nsy, 3, 0.1);
+    assert( std::abs(fs[nsx / 2 - 1 + y * nsx] - 1500) < 0.02 );
+    assert( std::abs(fs[nsx / 2 + y * nsx] - 1501) < 0.02 );
+
+    // no-data defaults to NaN: a cell at 0 m is smoothed, NaN is kept
+    gdalwrap::raster zero(low);
+    zero[10 + 10 * nsx] = 0;
+    zero[20 + 20 * nsx] = std::numeric_limits<float>::quiet_NaN();
+    fs = gdalwrap::bilateral_filter(zero, nsx, nsy, 3, 0.1);
+    assert( fs[10 + 10 * nsx] != 0 );
+    assert( std::abs(fs[10 + 10 * nsx]) < max_noise / 2 );
+    assert( std::isnan(fs[20 + 20 * nsx]) );
+    assert( !std::isnan(fs[21 + 20 * nsx]) );
+
+    // an outlier spike would need 10^11 grid cells: the range sampling is
+    // coarsened, the terrain is still smoothed
+    gdalwrap::raster spike(low);
+    spike[0] = 1e6;
+    fs = gdalwrap::bilateral_filter(spike, nsx, nsy, 3, 0.01);
+    double max_spike = 0;
+    for (size_t i = 1; i < nsx * nsy; i++)
+        max_spike = std::max(max_spike, std::abs(double(fs[i])));
+    assert( max_spike < max_noise / 2 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
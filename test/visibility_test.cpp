@@ -0,0 +1,55 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <gdalwrap/visibility.hpp>
+
+static const long nsx = 50;
+static const long nsy = 30;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap visibility test..." << std::endl;
+
+    // flat ground with a 10 m wall on the column 20
+    gdalwrap::gdal map;
+    map.set_transform(0, 0, 1, 1);
+    map.set_size(1, nsx, nsy);
+    for (long y = 0; y < nsy; y++)
+        map.bands[0][20 + y * nsx] = 10;
+    gdalwrap::point_xy_t observer = {{10, 15}};
+
+    // the ground is visible up to the wall (included), hidden behind it
+    gdalwrap::raster visible = gdalwrap::viewshed(map, 0, observer, 2);
+    for (long y = 0; y < nsy; y++)
+        for (long x = 0; x < nsx; x++)
+            assert( visible[x + y * nsx] == (x <= 20 ? 1 : 0) );
+    assert( gdalwrap::line_of_sight(map, 0, observer, 2, {{18, 3}}, 0) );
+    assert( !gdalwrap::line_of_sight(map, 0, observer, 2, {{25, 15}}, 0) );
+
+    // 20 m masts behind the wall: visible while 18 / d >= 8 / 10 along
+    // the row of the observer, up to 22.5 m away
+    visible = gdalwrap::viewshed(map, 0, observer, 2, 20);
+    for (long x = 21; x < nsx; x++)
+        assert( visible[x + 15 * nsx] == (x <= 32 ? 1 : 0) );
+    assert( gdalwrap::line_of_sight(map, 0, observer, 2, {{32, 15}}, 20) );
+    assert( !gdalwrap::line_of_sight(map, 0, observer, 2, {{34, 15}}, 20) );
+
+    // max distance
+    visible = gdalwrap::viewshed(map, 0, observer, 2, 0, 5);
+    for (long y = 0; y < nsy; y++)
+        for (long x = 0; x < nsx; x++) {
+            double d = std::hypot(x - 10, y - 15);
+            if (d > 5)
+                assert( visible[x + y * nsx] == 0 );
+            else if (d < 4)
+                assert( visible[x + y * nsx] == 1 );
+        }
+
+    // observer out of the map
+    visible = gdalwrap::viewshed(map, 0, {{-5, 15}}, 2);
+    for (float v : visible)
+        assert( v == 0 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+#undef NDEBUG
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <gdalwrap/warp.hpp>
+
+static const size_t nsx = 30;
+static const size_t nsy = 20;
+
+int main(int argc, char * argv[]) {
+    std::cout << "gdalwrap warp test..." << std::endl;
+
+    gdalwrap::gdal map;
+    map.set_transform(1000, 2000, 0.5, -0.5);
+    map.set_size(2, nsx, nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++) {
+            map.bands[0][x + y * nsx] = x + 100 * y;
+            map.bands[1][x + y * nsx] = (x * 7 + y * 13) % 5;
+        }
+
+    // identity: the same values back
+    gdalwrap::gdal same = gdalwrap::warp(map, map.get_transform(), nsx, nsy);
+    assert( same.bands[0] == map.bands[0] );
+    assert( same.bands[1] == map.bands[1] );
+
+    // translation by (2, -3) cells, and back
+    gdalwrap::transform_t t = map.get_transform();
+    t[0] += 2 * 0.5;
+    t[3] += 3 * -0.5;
+    gdalwrap::gdal moved = gdalwrap::warp(map, t, nsx, nsy, -1);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx; x++) {
+            float expected = (x + 2 < nsx and y + 3 < nsy) ?
+                map.bands[1][x + 2 + (y + 3) * nsx] : -1;
+            assert( moved.bands[1][x + y * nsx] == expected );
+        }
+    gdalwrap::gdal back = gdalwrap::warp(moved, map.get_transform(),
+        nsx, nsy, -1);
+    for (size_t y = 3; y < nsy; y++)
+        for (size_t x = 2; x < nsx; x++)
+            assert( back.bands[1][x + y * nsx] == map.bands[1][x + y * nsx] );
+
+    // half a cell: bilinear on a plane is exact
+    t = map.get_transform();
+    t[0] += 0.25;
+    gdalwrap::gdal half = gdalwrap::warp(map, t, nsx - 1, nsy);
+    for (size_t y = 0; y < nsy; y++)
+        for (size_t x = 0; x < nsx - 1; x++)
+            assert( std::abs(half.bands[0][x + y * (nsx - 1)] -
+                             (x + 0.5 + 100 * y)) < 1e-4 );
+
+    // twice coarser, same origin: cell (x, y) is source cell (2 x, 2 y)
+    t = map.get_transform();
+    t[1] *= 2;
+    t[5] *= 2;
+    gdalwrap::gdal coarse = gdalwrap::warp(map, t, nsx / 2, nsy / 2);
+    for (size_t y = 0; y < nsy / 2; y++)
+        for (size_t x = 0; x < nsx / 2; x++)
+            assert( std::abs(coarse.bands[0][x + y * nsx / 2] -
+                             (2 * x + 200 * y)) < 1e-4 );
+
+    // heading grid centered on a cell center of the map
+    gdalwrap::point_xy_t center = map.point_pix2utm(15, 10);
+    t = gdalwrap::heading_transform(center[0], center[1], M_PI / 2, 0.5,
+        5, 3);
+    gdalwrap::gdal rotated = gdalwrap::warp(map, t, 5, 3);
+    // the center cell of a 5 x 3 grid is (2, 1)
+    assert( std::abs(rotated.bands[0][2 + 1 * 5] - (15 + 100 * 10)) < 1e-3 );
+    // columns go forward (north, up in the map), rows to the right (east)
+    assert( std::abs(rotated.bands[0][3 + 1 * 5] - (15 + 100 * 9)) < 1e-3 );
+    assert( std::abs(rotated.bands[0][2 + 2 * 5] - (16 + 100 * 10)) < 1e-3 );
+
+    std::cout << "done." << std::endl;
+    return 0;
+}
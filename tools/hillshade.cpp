@@ -0,0 +1,24 @@
+#include <cstdlib> // std::atof, std::atoi
+#include <iostream>
+#include <gdalwrap/gdal.hpp>
+#include <gdalwrap/shading.hpp>
+
+int main(int argc, char * argv[]) {
+    if (argc < 4) {
+        std::cerr << "usage: " << argv[0] << " file.tif band "
+            "file.{png,jpg,gif} [azimuth altitude]" << std::endl;
+        return 1;
+    }
+    gdalwrap::gdal geotiff(argv[1]);
+    double azimuth  = (argc > 4) ? std::atof(argv[4]) : 315;
+    double altitude = (argc > 5) ? std::atof(argv[5]) : 45;
+    std::string filepath = argv[3];
+    std::string ext = gdalwrap::toupper(
+        filepath.substr( filepath.rfind(".") + 1 ) );
+    if (!ext.compare("JPG"))
+        ext = "JPEG";
+    geotiff.export8u(filepath, { gdalwrap::hillshade(geotiff,
+        std::atoi(argv[2]), azimuth, altitude) }, ext);
+
+    return 0;
+}